@@ -0,0 +1,36 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_HPP_INCLUDED
+#define KUMI_ALGORITHM_HPP_INCLUDED
+
+//==================================================================================================
+//! @file algorithm.hpp
+//! @brief Includes all kumi algorithms
+//!
+//! Each algorithm can also be included on its own from `kumi/algorithm/`, on top of the kumi::tuple
+//! definitions provided by `kumi/core.hpp`.
+//==================================================================================================
+#include <kumi/algorithm/cartesian_product.hpp>
+#include <kumi/algorithm/cat.hpp>
+#include <kumi/algorithm/filter.hpp>
+#include <kumi/algorithm/find_if.hpp>
+#include <kumi/algorithm/flatten.hpp>
+#include <kumi/algorithm/fold.hpp>
+#include <kumi/algorithm/for_each.hpp>
+#include <kumi/algorithm/generate.hpp>
+#include <kumi/algorithm/map.hpp>
+#include <kumi/algorithm/minmax.hpp>
+#include <kumi/algorithm/predicates.hpp>
+#include <kumi/algorithm/push_pop.hpp>
+#include <kumi/algorithm/reduce.hpp>
+#include <kumi/algorithm/reorder.hpp>
+#include <kumi/algorithm/transpose.hpp>
+#include <kumi/algorithm/visit.hpp>
+#include <kumi/algorithm/zip.hpp>
+
+#endif
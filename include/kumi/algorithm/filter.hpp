@@ -0,0 +1,238 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_FILTER_HPP_INCLUDED
+#define KUMI_ALGORITHM_FILTER_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  namespace detail
+  {
+    // Indexes of the elements of T whose type satisfies Pred followed by the indexes of the
+    // others, both groups keeping their original order
+    template<template<class> class Pred, typename T> struct type_partition
+    {
+      static constexpr auto map = []<std::size_t... I>(std::index_sequence<I...>)
+      {
+        // size is at least 1 so MSVC don't cry when we use a 0-sized array
+        struct { std::size_t count, index[sizeof...(I)+1]; } that{};
+        bool const selected[] = { static_cast<bool>(Pred<element_t<I,T>>::value)..., false };
+
+        for(std::size_t i=0;i<sizeof...(I);++i)
+          if(selected[i]) that.index[that.count++] = i;
+
+        for(std::size_t i=0, k=that.count;i<sizeof...(I);++i)
+          if(!selected[i]) that.index[k++] = i;
+
+        return that;
+      }(std::make_index_sequence<size<T>::value>{});
+    };
+
+    // Indexes of the elements of T sorted by increasing Key, stable w.r.t declaration order
+    template<template<class> class Key, typename T> struct type_order
+    {
+      static constexpr auto map = []<std::size_t... I>(std::index_sequence<I...>)
+      {
+        struct { std::size_t index[sizeof...(I)+1]; } that{};
+
+        if constexpr(sizeof...(I) > 0)
+        {
+          using key_t = std::common_type_t<decltype(Key<element_t<I,T>>::value)...>;
+          key_t const key[] = { static_cast<key_t>(Key<element_t<I,T>>::value)... };
+
+          for(std::size_t i=0;i<sizeof...(I);++i)
+          {
+            std::size_t j = i;
+            while(j > 0 && key[i] < key[that.index[j-1]])
+            {
+              that.index[j] = that.index[j-1];
+              --j;
+            }
+            that.index[j] = i;
+          }
+        }
+
+        return that;
+      }(std::make_index_sequence<size<T>::value>{});
+    };
+
+    // Type of the kumi::tuple of the elements of T listed in Map::map.index[Offset, Offset+Count[
+    template<typename Map, std::size_t Offset, typename T, typename Seq> struct select_result;
+
+    template<typename Map, std::size_t Offset, typename T, std::size_t... K>
+    struct select_result<Map, Offset, T, std::index_sequence<K...>>
+    {
+      using type = kumi::tuple<element_t<Map::map.index[Offset+K], T>...>;
+    };
+
+    template<typename Map, std::size_t Offset, std::size_t Count, typename T>
+    using select_t = typename select_result < Map, Offset, std::remove_cvref_t<T>
+                                            , std::make_index_sequence<Count>
+                                            >::type;
+
+    // Moves or copies the elements of t listed in Map::map.index[Offset, Offset+Count[
+    template<typename Map, std::size_t Offset, std::size_t Count, typename Tuple>
+    constexpr auto select(Tuple&& t)
+    {
+      return [&]<std::size_t... K>(std::index_sequence<K...>)
+      {
+        return select_t<Map, Offset, Count, Tuple>{ get<Map::map.index[Offset+K]>(KUMI_FWD(t))... };
+      }(std::make_index_sequence<Count>{});
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Selects the elements of a kumi::product_type whose type satisfies a predicate
+  //!
+  //! The indexes of the selected elements are computed at compile time. If t is an rvalue, the
+  //! selected elements are moved into the result.
+  //!
+  //! @tparam Pred Unary template meta-program evaluated on each element type
+  //! @param  t    kumi::product_type to process
+  //! @return A kumi::tuple containing, in order, the elements of t whose type `T` verifies
+  //!         `Pred<T>::value`.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<template<class> class Pred, product_type Tuple> struct filter;
+  //!
+  //!   template<template<class> class Pred, product_type Tuple>
+  //!   using filter_t = typename filter<Pred,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::filter
+  //!
+  //! ## Example
+  //! @include doc/filter.cpp
+  //================================================================================================
+  template<template<class> class Pred, product_type Tuple>
+  [[nodiscard]] constexpr auto filter(Tuple&& t)
+  {
+    using map_t = detail::type_partition<Pred, std::remove_cvref_t<Tuple>>;
+    return detail::select<map_t, 0, map_t::map.count>(KUMI_FWD(t));
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Splits a kumi::product_type in the elements whose type satisfies a predicate and
+  //!        the others
+  //!
+  //! The indexes of both groups of elements are computed at compile time. If t is an rvalue, its
+  //! elements are moved into the result.
+  //!
+  //! @tparam Pred Unary template meta-program evaluated on each element type
+  //! @param  t    kumi::product_type to process
+  //! @return A kumi::tuple containing the kumi::tuple of the elements of t whose type `T` verifies
+  //!         `Pred<T>::value` and the kumi::tuple of the other elements, both in order.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<template<class> class Pred, product_type Tuple> struct partition;
+  //!
+  //!   template<template<class> class Pred, product_type Tuple>
+  //!   using partition_t = typename partition<Pred,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::partition
+  //!
+  //! ## Example
+  //! @include doc/filter.cpp
+  //================================================================================================
+  template<template<class> class Pred, product_type Tuple>
+  [[nodiscard]] constexpr auto partition(Tuple&& t)
+  {
+    using map_t = detail::type_partition<Pred, std::remove_cvref_t<Tuple>>;
+    constexpr auto n = map_t::map.count;
+
+    return kumi::make_tuple ( detail::select<map_t, 0, n>(KUMI_FWD(t))
+                            , detail::select<map_t, n, size<Tuple>::value - n>(KUMI_FWD(t))
+                            );
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Sorts the elements of a kumi::product_type by a compile-time key of their type
+  //!
+  //! The sorting permutation is computed at compile time and is stable: elements with equivalent
+  //! keys keep their original order. If t is an rvalue, its elements are moved into the result.
+  //!
+  //! @tparam Key Unary template meta-program evaluated on each element type
+  //! @param  t   kumi::product_type to process
+  //! @return A kumi::tuple containing the elements of t sorted by increasing `Key<T>::value`.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<template<class> class Key, product_type Tuple> struct sort_by;
+  //!
+  //!   template<template<class> class Key, product_type Tuple>
+  //!   using sort_by_t = typename sort_by<Key,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::sort_by
+  //!
+  //! ## Example
+  //! @include doc/sort_by.cpp
+  //================================================================================================
+  template<template<class> class Key, product_type Tuple>
+  [[nodiscard]] constexpr auto sort_by(Tuple&& t)
+  {
+    using map_t = detail::type_order<Key, std::remove_cvref_t<Tuple>>;
+    return detail::select<map_t, 0, size<Tuple>::value>(KUMI_FWD(t));
+  }
+
+  namespace result
+  {
+    template<template<class> class Pred, product_type Tuple> struct filter
+    {
+      using map_t = detail::type_partition<Pred, std::remove_cvref_t<Tuple>>;
+      using type  = detail::select_t<map_t, 0, map_t::map.count, Tuple>;
+    };
+
+    template<template<class> class Pred, product_type Tuple> struct partition
+    {
+      using map_t = detail::type_partition<Pred, std::remove_cvref_t<Tuple>>;
+      using type  = kumi::tuple < detail::select_t<map_t, 0, map_t::map.count, Tuple>
+                                , detail::select_t< map_t, map_t::map.count
+                                                  , size<Tuple>::value - map_t::map.count
+                                                  , Tuple
+                                                  >
+                                >;
+    };
+
+    template<template<class> class Key, product_type Tuple> struct sort_by
+    {
+      using map_t = detail::type_order<Key, std::remove_cvref_t<Tuple>>;
+      using type  = detail::select_t<map_t, 0, size<Tuple>::value, Tuple>;
+    };
+
+    template<template<class> class Pred, product_type Tuple>
+    using filter_t = typename filter<Pred,Tuple>::type;
+
+    template<template<class> class Pred, product_type Tuple>
+    using partition_t = typename partition<Pred,Tuple>::type;
+
+    template<template<class> class Key, product_type Tuple>
+    using sort_by_t = typename sort_by<Key,Tuple>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
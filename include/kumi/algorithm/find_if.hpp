@@ -0,0 +1,62 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_FIND_IF_HPP_INCLUDED
+#define KUMI_ALGORITHM_FIND_IF_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup queries
+  //! @brief  Return the index of the first element satisfying a given predicate
+  //!
+  //! Elements are tested in order and p is not called on any element following the first one
+  //! satisfying it.
+  //!
+  //! @param  t kumi::product_type to process
+  //! @param  p Unary predicate. p must return a value convertible to `bool` for every element of t.
+  //! @return Integral index of the first element satisfying p if present, kumi::size<Tuple>::value
+  //!         otherwise.
+  //! ## Example:
+  //! @include doc/find_if.cpp
+  //================================================================================================
+  template<typename Pred, product_type Tuple>
+  [[nodiscard]] constexpr std::size_t find_if( Tuple&& t, Pred p )
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      std::size_t found = sizeof...(I);
+      [[maybe_unused]] bool const stop = ( (p(get<I>(KUMI_FWD(t))) ? (found = I, true) : false) || ... );
+      return found;
+    }(std::make_index_sequence<size<Tuple>::value>{});
+  }
+
+  //================================================================================================
+  //! @ingroup queries
+  //! @brief  Return the index of a value which type satisfies a given predicate
+  //!
+  //! Equivalent to kumi::find_if, evaluation stops at the first element satisfying p.
+  //!
+  //! @param  t kumi::product_type to process
+  //! @param  p Unary predicate. p must return a value convertible to `bool` for every element of t.
+  //! @return Integral index of the element inside the tuple if present, kumi::size<Tuple>::value
+  //!         otherwise.
+  //! ## Example:
+  //! @include doc/locate.cpp
+  //================================================================================================
+  template<typename Pred, product_type Tuple>
+  [[nodiscard]] constexpr auto locate( Tuple const& t, Pred p ) noexcept
+  {
+    return kumi::find_if(t, p);
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,350 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_FLATTEN_HPP_INCLUDED
+#define KUMI_ALGORITHM_FLATTEN_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/algorithm/cat.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Converts a tuple of tuples into a tuple of all elements.
+  //!
+  //! @param ts Tuple to flatten
+  //! @return A tuple composed of all elements of t flattened non-recursively
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct flatten;
+  //!
+  //!   template<product_type Tuple>
+  //!   using flatten_t = typename flatten<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::flatten
+  //!
+  //! ## Example
+  //! @include doc/flatten.cpp
+  //================================================================================================
+  template<product_type Tuple> [[nodiscard]] constexpr auto flatten(Tuple&& ts)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return ts;
+    else
+    {
+      return kumi::apply( [](auto&&... m)
+                          {
+                            auto v_or_t = []<typename V>(V&& v)
+                            {
+                              if constexpr(product_type<V>) return KUMI_FWD(v);
+                              else                          return kumi::tuple{KUMI_FWD(v)};
+                            };
+
+                            return cat( v_or_t(KUMI_FWD(m))... );
+                          }
+                        , KUMI_FWD(ts)
+                        );
+    }
+  }
+
+  //================================================================================================
+  // Flattened index map
+  //================================================================================================
+  namespace detail
+  {
+    template<typename T> constexpr std::size_t flat_count() noexcept
+    {
+      if constexpr(product_type<T>)
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return (flat_count<element_t<I,T>>() + ... + 0);
+        }(std::make_index_sequence<size<T>::value>{});
+      }
+      else return 1;
+    }
+
+    template<typename T> constexpr std::size_t flat_depth() noexcept
+    {
+      if constexpr(product_type<T>)
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          std::size_t d = 0;
+          ((d = flat_depth<element_t<I,T>>() > d ? flat_depth<element_t<I,T>>() : d), ...);
+          return d + 1;
+        }(std::make_index_sequence<size<T>::value>{});
+      }
+      else return 0;
+    }
+
+    // Path of indexes leading to each leaf of a tree of nested product types
+    template<std::size_t N, std::size_t D> struct flat_paths
+    {
+      static constexpr std::size_t count = N;
+      std::size_t depth[N+1];
+      std::size_t path[N+1][D+1];
+    };
+
+    template<typename T, typename Map>
+    constexpr void fill_flat_paths(Map& m, std::size_t& k, std::size_t const* prefix, std::size_t d)
+    {
+      if constexpr(product_type<T>)
+      {
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+          [[maybe_unused]] std::size_t local[sizeof(m.path[0])/sizeof(std::size_t)] = {};
+          for(std::size_t i=0;i<d;++i) local[i] = prefix[i];
+
+          ((local[d] = I, fill_flat_paths<element_t<I,T>>(m, k, local, d+1)), ...);
+        }(std::make_index_sequence<size<T>::value>{});
+      }
+      else
+      {
+        m.depth[k] = d;
+        for(std::size_t i=0;i<d;++i) m.path[k][i] = prefix[i];
+        ++k;
+      }
+    }
+
+    template<typename T> constexpr auto make_flat_paths() noexcept
+    {
+      flat_paths<flat_count<T>(), flat_depth<T>()> m = {};
+      std::size_t k = 0;
+      fill_flat_paths<T>(m, k, nullptr, 0);
+      return m;
+    }
+
+    // Computed once per tree type and shared by all algorithms working on its leaves
+    template<typename T> inline constexpr auto flat_map = make_flat_paths<T>();
+
+    template<typename T, std::size_t K, std::size_t L = 0, typename U>
+    constexpr decltype(auto) get_flat(U&& u) noexcept
+    {
+      if constexpr(L == flat_map<T>.depth[K]) return KUMI_FWD(u);
+      else return get_flat<T,K,L+1>(get<flat_map<T>.path[K][L]>(KUMI_FWD(u)));
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Recursively converts a tuple of tuples into a tuple of all elements.
+  //!
+  //! Recursively converts a tuple of tuples `t` into a tuple of all elements of said tuples.
+  //! If the Callable object f is provided, non-tuple elements are processed by `f` before being
+  //! inserted.
+  //!
+  //! @param ts Tuple to flatten
+  //! @param f  Optional Callable object to apply when a sub-tuple is flattened
+  //! @return A tuple composed of all elements of t flattened recursively
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple, typename Func = void> struct flatten_all;
+  //!
+  //!   template<product_type Tuple, typename Func = void>
+  //!   using flatten_all_t = typename flatten_all<Tuple, Func>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::flatten_all
+  //!
+  //! ## Example
+  //! @include doc/flatten_all.cpp
+  //================================================================================================
+  template<product_type Tuple> [[nodiscard]] constexpr auto flatten_all(Tuple&& ts)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return ts;
+    else
+    {
+      using type = std::remove_cvref_t<Tuple>;
+      return [&]<std::size_t... K>(std::index_sequence<K...>)
+      {
+        return kumi::make_tuple( detail::get_flat<type,K>(KUMI_FWD(ts))... );
+      }(std::make_index_sequence<detail::flat_map<type>.count>{});
+    }
+  }
+
+  /// @overload
+  template<product_type Tuple, typename Func>
+  [[nodiscard]] constexpr auto flatten_all(Tuple&& ts, Func&& f)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return KUMI_FWD(ts);
+    else
+    {
+      using type = std::remove_cvref_t<Tuple>;
+      return [&]<std::size_t... K>(std::index_sequence<K...>)
+      {
+        using flat_t = kumi::tuple< std::unwrap_ref_decay_t
+                                    < decltype(f(detail::get_flat<type,K>(ts)))
+                                    >...
+                                  >;
+        return flat_t{ f(detail::get_flat<type,K>(ts))... };
+      }(std::make_index_sequence<detail::flat_map<type>.count>{});
+    }
+  }
+
+  namespace detail
+  {
+    // Elements of a kumi::product_type are kept as is by kumi::flatten, others are wrapped
+    template<typename V>      struct flatten_piece    { using type = deduced_tuple_t<V>; };
+    template<product_type V>  struct flatten_piece<V> { using type = elements_t<V>;      };
+
+    template<typename Tuple, typename Seq> struct flatten_result;
+
+    template<typename Tuple, std::size_t... I>
+    struct flatten_result<Tuple, std::index_sequence<I...>>
+    {
+      using type = cat_types_t<typename flatten_piece<get_result_t<I,Tuple>>::type...>;
+    };
+
+    template<typename Tuple> struct flatten_result<Tuple, std::index_sequence<>>
+    {
+      using type = std::remove_cvref_t<Tuple>;
+    };
+
+    // Types of the accesses to the leaves of a tree of nested product types, in order
+    template<typename T, typename Seq = void> struct flat_leaves
+    {
+      using type = kumi::tuple<T>;
+    };
+
+    template<product_type T> struct flat_leaves<T, void>
+         : flat_leaves<T, std::make_index_sequence<size<T>::value>>
+    {};
+
+    template<typename T, std::size_t... I> struct flat_leaves<T, std::index_sequence<I...>>
+    {
+      using type = cat_types_t<typename flat_leaves<get_result_t<I,T>>::type...>;
+    };
+
+    // Leaves are stored by value, after being passed to f if any
+    template<typename Leaves, typename Function> struct flat_result;
+
+    template<typename... Ls, typename Function>
+    struct flat_result<kumi::tuple<Ls...>, Function>
+    {
+      using type = kumi::tuple<std::unwrap_ref_decay_t<std::invoke_result_t<Function&, Ls>>...>;
+    };
+
+    template<typename... Ls> struct flat_result<kumi::tuple<Ls...>, void>
+    {
+      using type = kumi::tuple<std::unwrap_ref_decay_t<Ls>...>;
+    };
+
+    // f is called on lvalues of the leaves, an empty tuple being returned as is
+    template<typename Tuple, typename Function, bool Empty = (size<Tuple>::value == 0)>
+    struct flatten_all_result
+    {
+      using leaves  = typename flat_leaves<std::remove_reference_t<Tuple>&>::type;
+      using type    = typename flat_result< leaves
+                                          , std::conditional_t< std::is_void_v<Function>
+                                                              , void
+                                                              , std::remove_reference_t<Function>
+                                                              >
+                                          >::type;
+    };
+
+    template<typename Tuple, typename Function>
+    struct flatten_all_result<Tuple, Function, true>
+    {
+      using type = std::remove_cvref_t<Tuple>;
+    };
+  }
+
+  namespace result
+  {
+    template<product_type Tuple> struct flatten
+    {
+      using type = typename detail::flatten_result< Tuple
+                                                  , std::make_index_sequence<size<Tuple>::value>
+                                                  >::type;
+    };
+
+    template<product_type Tuple, typename Func = void> struct flatten_all
+    {
+      using type = typename detail::flatten_all_result<Tuple, Func>::type;
+    };
+
+    template<product_type Tuple> using flatten_t      = typename flatten<Tuple>::type;
+
+    template<product_type Tuple, typename Func = void>
+    using flatten_all_t  = typename flatten_all<Tuple, Func>::type;
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Convert a kumi::product_type to a flat tuple of pointers to each its components.
+  //!
+  //! @param ts Tuple to convert
+  //! @return A flat tuple composed of pointers to each elements of t.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct as_flat_ptr;
+  //!
+  //!   template<product_type Tuple>
+  //!   using as_flat_ptr_t = typename as_flat_ptr<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::as_flat_ptr
+  //!
+  //! ## Example
+  //! @include doc/as_flat_ptr.cpp
+  //================================================================================================
+  template<product_type Tuple>
+  [[nodiscard]] auto as_flat_ptr(Tuple&& t) noexcept
+  {
+    return kumi::flatten_all(t, [](auto& m) { return &m; });
+  }
+
+  namespace detail
+  {
+    template<typename Leaves> struct flat_pointers;
+
+    template<typename... Ls> struct flat_pointers<kumi::tuple<Ls...>>
+    {
+      using type = kumi::tuple<decltype(&std::declval<Ls>())...>;
+    };
+
+    template<typename T, bool Empty = (size<T>::value == 0)> struct as_flat_ptr_result
+    {
+      using type = typename flat_pointers < typename flat_leaves<std::remove_reference_t<T>&>::type
+                                          >::type;
+    };
+
+    template<typename T> struct as_flat_ptr_result<T, true>
+    {
+      using type = std::remove_cvref_t<T>;
+    };
+  }
+
+  namespace result
+  {
+    template<product_type T> struct as_flat_ptr
+    {
+      using type = typename detail::as_flat_ptr_result<T>::type;
+    };
+
+    template<product_type T>
+    using as_flat_ptr_t = typename as_flat_ptr<T>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,185 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_FOLD_HPP_INCLUDED
+#define KUMI_ALGORITHM_FOLD_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  namespace detail
+  {
+    //==============================================================================================
+    // Fold helpers
+    //==============================================================================================
+    template<typename F, typename T> struct foldable
+    {
+      F func;
+      T value;
+
+      template<typename W>
+      friend constexpr decltype(auto) operator>>(foldable &&x, foldable<F, W> &&y)
+      {
+        return detail::foldable {x.func, x.func(y.value, x.value)};
+      }
+
+      template<typename W>
+      friend constexpr decltype(auto) operator<<(foldable &&x, foldable<F, W> &&y)
+      {
+        return detail::foldable {x.func, x.func(x.value, y.value)};
+      }
+    };
+
+    template<class F, class T> foldable(const F &, T &&) -> foldable<F, T>;
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the generalized sum of all elements using a tail recursive tail.
+  //!
+  //! @param f      Binary callable function to apply
+  //! @param t      Tuple to operate on
+  //! @param init   Initial value of the sum
+  //! @return   The value of `f( f( f(init, get<0>(t)), ...), get<N-1>(t))`
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type Tuple, typename Value> struct fold_left;
+  //!
+  //!   template<typename Function, product_type Tuple, typename Value>
+  //!   using fold_left_t = typename fold_left_t<Function,Tuple,Value>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::fold_left
+  //!
+  //! ## Example
+  //! @include doc/fold_left.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple, typename Value>
+  [[nodiscard]] constexpr auto fold_left(Function f, Tuple&& t, Value init)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return init;
+    else
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return (detail::foldable {f, get<I>(KUMI_FWD(t))} >> ... >> detail::foldable {f, init}).value;
+      }
+      (std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the generalized sum of all elements using a non-tail recursive tail.
+  //!
+  //! @param f      Binary callable function to apply
+  //! @param t      Tuple to operate on
+  //! @param init   Initial value of the sum
+  //! @return   The value of `f(get<0>(t), f(... , f(get<N-1>(t), init))`
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type Tuple, typename Value> struct fold_right;
+  //!
+  //!   template<typename Function, product_type Tuple, typename Value>
+  //!   using fold_right_t = typename fold_right_t<Function,Tuple,Value>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::fold_right
+  //!
+  //! ## Example
+  //! @include doc/fold_right.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple, typename Value>
+  [[nodiscard]] constexpr auto fold_right(Function f, Tuple&& t, Value init)
+  {
+    if constexpr(size<Tuple>::value ==0) return init;
+    else
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return (detail::foldable {f, init} << ... << detail::foldable {f, get<I>(KUMI_FWD(t))}).value;
+      }
+      (std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  namespace detail
+  {
+    // Type of f(...f(f(acc, t0), t1)..., tn) as computed through detail::foldable, which calls f as
+    // an lvalue on lvalues of its accumulator and of the elements
+    template<typename Function, typename Acc, typename... Ts> struct fold_types
+    {
+      using type = Acc;
+    };
+
+    template<typename Function, typename Acc, typename T, typename... Ts>
+    struct fold_types<Function, Acc, T, Ts...>
+         : fold_types < Function
+                      , std::invoke_result_t< Function&
+                                            , std::remove_reference_t<Acc>&
+                                            , std::remove_reference_t<T>&
+                                            >
+                      , Ts...
+                      >
+    {};
+
+    template<typename Function, typename Tuple, typename Value, typename Seq> struct fold_result;
+
+    template<typename Function, typename Tuple, typename Value, std::size_t... I>
+    struct fold_result<Function, Tuple, Value, std::index_sequence<I...>>
+    {
+      // kumi::fold_right combines elements from the first one
+      using right = std::decay_t<typename fold_types<Function, Value&, get_result_t<I,Tuple>...>::type>;
+
+      // kumi::fold_left combines elements from the last one
+      using left  = std::decay_t< typename fold_types < Function, Value&
+                                                      , get_result_t<sizeof...(I) - 1 - I,Tuple>...
+                                                      >::type
+                                >;
+    };
+  }
+
+  namespace result
+  {
+    template<typename Function, product_type Tuple, typename Value>
+    struct fold_right
+    {
+      using type = typename detail::fold_result < std::decay_t<Function>, Tuple
+                                                , std::decay_t<Value>
+                                                , std::make_index_sequence<size<Tuple>::value>
+                                                >::right;
+    };
+
+    template<typename Function, product_type Tuple, typename Value>
+    struct fold_left
+    {
+      using type = typename detail::fold_result < std::decay_t<Function>, Tuple
+                                                , std::decay_t<Value>
+                                                , std::make_index_sequence<size<Tuple>::value>
+                                                >::left;
+    };
+
+    template<typename Function, product_type Tuple, typename Value>
+    using fold_right_t = typename fold_right<Function,Tuple,Value>::type;
+
+    template<typename Function, product_type Tuple, typename Value>
+    using fold_left_t = typename fold_left<Function,Tuple,Value>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
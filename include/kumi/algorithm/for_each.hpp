@@ -0,0 +1,143 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_FOR_EACH_HPP_INCLUDED
+#define KUMI_ALGORITHM_FOR_EACH_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each element of a kumi::product_type.
+  //!
+  //! @note This function does not take part in overload resolution if `f` can't be applied to the
+  //!       elements of `t` and/or `ts`.
+  //!
+  //! @param f	  Callable object to be invoked
+  //! @param t    kumi::product_type whose elements to be used as arguments to f
+  //! @param ts   Other kumi::product_type whose elements to be used as arguments to f
+  //!
+  //! @see kumi::for_each_index
+  //!
+  //! ## Example
+  //! @include doc/for_each.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple, product_type... Tuples>
+  constexpr void for_each(Function f, Tuple&& t, Tuples&&... ts)
+  requires detail::applicable<Function, Tuple, Tuples...>
+  {
+    if constexpr(sized_product_type<Tuple,0>) return;
+    else
+    {
+      [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        // clang needs this for some reason
+        using std::get;
+        [[maybe_unused]] auto call = [&]<typename M>(M)
+                                        { f ( get<M::value>(KUMI_FWD(t))
+                                            , get<M::value>(KUMI_FWD(ts))...
+                                            );
+                                        };
+
+        ( call(std::integral_constant<std::size_t, I>{}), ... );
+      }
+      (std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each element of a kumi::product_type and its index.
+  //!
+  //! @note This function does not take part in overload resolution if `f` can't be applied to the
+  //!       elements of `t` and/or `ts` and an integral constant.
+  //!
+  //! @param f	  Callable object to be invoked
+  //! @param t    kumi::product_type whose elements to be used as arguments to f
+  //! @param ts   Other kumi::product_type whose elements to be used as arguments to f
+  //!
+  //! @see kumi::for_each
+  //!
+  //! ## Example
+  //! @include doc/for_each_index.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple, product_type... Tuples>
+  constexpr void for_each_index(Function f, Tuple&& t, Tuples&&... ts)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return;
+    else
+    {
+      [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        // clang needs this for some reason
+        using std::get;
+        [[maybe_unused]] auto call = [&]<typename M>(M idx)
+                                        { f ( idx
+                                            , get<M::value>(KUMI_FWD(t))
+                                            , get<M::value>(KUMI_FWD(ts))...
+                                            );
+                                        };
+
+        ( call(std::integral_constant<std::size_t, I>{}), ... );
+      }
+      (std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each element of a kumi::product_type until it
+  //!        returns `true`.
+  //!
+  //! Elements are visited in order and f is not called on any element following the first one
+  //! for which it returned a value equivalent to `true`.
+  //!
+  //! @note This function does not take part in overload resolution if `f` can't be applied to the
+  //!       elements of `t` and/or `ts`.
+  //!
+  //! @param f	  Callable object to be invoked. Its result must be convertible to `bool`.
+  //! @param t    kumi::product_type whose elements to be used as arguments to f
+  //! @param ts   Other kumi::product_type whose elements to be used as arguments to f
+  //! @return Index of the first elements for which f returned `true`, kumi::size<Tuple>::value if the
+  //!         iteration was never stopped.
+  //!
+  //! @see kumi::for_each
+  //!
+  //! ## Example
+  //! @include doc/for_each_until.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple, product_type... Tuples>
+  constexpr std::size_t for_each_until(Function f, Tuple&& t, Tuples&&... ts)
+  requires detail::applicable<Function, Tuple, Tuples...>
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      // clang needs this for some reason
+      using std::get;
+      [[maybe_unused]] auto call = [&]<typename M>(M)
+                                      { return static_cast<bool>( f ( get<M::value>(KUMI_FWD(t))
+                                                                    , get<M::value>(KUMI_FWD(ts))...
+                                                                    )
+                                                                );
+                                      };
+
+      std::size_t stopped = sizeof...(I);
+      [[maybe_unused]] bool const stop = ( ( call(std::integral_constant<std::size_t, I>{})
+                                           ? (stopped = I, true) : false
+                                           ) || ...
+                                         );
+      return stopped;
+    }
+    (std::make_index_sequence<size<Tuple>::value>());
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,193 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_MAP_HPP_INCLUDED
+#define KUMI_ALGORITHM_MAP_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Apply the Callable object f on each tuples' elements
+  //!
+  //! Applies the given function to all the tuples passed as arguments and stores the result in
+  //! another tuple, keeping the original elements order.
+  //!
+  //! @note Does not participate in overload resolution if tuples' size are not equal or if `f`
+  //!       can't be called on each tuple's elements.
+  //!
+  //! @param f      Callable function to apply
+  //! @param t0     Tuple  to operate on
+  //! @param others Tuples to operate on
+  //! @return The tuple of `f` calls results.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type T, product_type... Ts> struct map;
+  //!
+  //!   template<typename Function, product_type T, product_type... Ts>
+  //!   using map_t = typename map<Function,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::map
+  //!
+  //! ## Example
+  //! @include doc/map.cpp
+  //================================================================================================
+  template<product_type Tuple, typename Function, sized_product_type<size<Tuple>::value>... Tuples>
+  constexpr auto
+  map(Function     f,
+      Tuple  &&t0,
+      Tuples &&...others) requires detail::applicable<Function, Tuple&&, Tuples&&...>
+  {
+    if constexpr(sized_product_type<Tuple,0>) return std::remove_cvref_t<Tuple>{};
+    else
+    {
+      auto const call = [&]<std::size_t N, typename... Ts>(index_t<N>, Ts &&... args)
+      {
+        return f(get<N>(KUMI_FWD(args))...);
+      };
+
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return kumi::make_tuple(call(index<I>, KUMI_FWD(t0), KUMI_FWD(others)...)...);
+      }(std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  namespace detail
+  {
+    // f is called as an lvalue and its results are stored by value
+    template<typename Function, typename Seq, typename... Tuples> struct map_result;
+
+    template<typename Function, std::size_t... I, typename... Tuples>
+    struct map_result<Function, std::index_sequence<I...>, Tuples...>
+    {
+      template<std::size_t N>
+      using call_t = std::invoke_result_t<Function&, get_result_t<N,Tuples>...>;
+
+      using type = kumi::tuple<std::unwrap_ref_decay_t<call_t<I>>...>;
+    };
+
+    template<typename Function, typename T, typename... Ts>
+    struct map_result<Function, std::index_sequence<>, T, Ts...>
+    {
+      using type = std::remove_cvref_t<T>;
+    };
+  }
+
+  namespace result
+  {
+    template<typename Function, product_type T, sized_product_type<size<T>::value>... Ts>
+    struct map
+    {
+      using type = typename detail::map_result< std::decay_t<Function>
+                                              , std::make_index_sequence<size<T>::value>
+                                              , T, Ts...
+                                              >::type;
+    };
+
+    template<typename Function, product_type T, sized_product_type<size<T>::value>... Ts>
+    using map_t = typename map<Function,T,Ts...>::type;
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Apply the Callable object f on each tuples' elements and their indexes
+  //!
+  //! Applies the given function to all the tuples passed as arguments along with their indexes  and
+  //! stores the result in another tuple, keeping the original elements order.
+  //!
+  //! @note Does not participate in overload resolution if tuples' size are not equal or if `f`
+  //!       can't be called on each tuple's elements and their indexes.
+  //!
+  //! @param f      Callable function to apply
+  //! @param t0     Tuple  to operate on
+  //! @param others Tuples to operate on
+  //! @return The tuple of `f` calls results.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type T, product_type... Ts> struct map_index;
+  //!
+  //!   template<typename Function, product_type T, product_type... Ts>
+  //!   using map_index_t = typename map_index<Function,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::map_index
+  //!
+  //! ## Example
+  //! @include doc/map_index.cpp
+  //================================================================================================
+  template<product_type Tuple, typename Function, sized_product_type<size<Tuple>::value>... Tuples>
+  constexpr auto map_index(Function     f,Tuple  &&t0,Tuples &&...others)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return std::remove_cvref_t<Tuple>{};
+    else
+    {
+      auto const call = [&]<std::size_t N, typename... Ts>(index_t<N> idx, Ts &&... args)
+      {
+        return f(idx, get<N>(args)...);
+      };
+
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return kumi::make_tuple(call(index<I>, KUMI_FWD(t0), KUMI_FWD(others)...)...);
+      }(std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  namespace detail
+  {
+    // f is called as an lvalue on the index and on lvalues of the elements
+    template<typename Function, typename Seq, typename... Tuples> struct map_index_result;
+
+    template<typename Function, std::size_t... I, typename... Tuples>
+    struct map_index_result<Function, std::index_sequence<I...>, Tuples...>
+    {
+      template<std::size_t N>
+      using call_t = std::invoke_result_t < Function&, index_t<N>&
+                                          , get_result_t<N, std::remove_reference_t<Tuples>&>...
+                                          >;
+
+      using type = kumi::tuple<std::unwrap_ref_decay_t<call_t<I>>...>;
+    };
+
+    template<typename Function, typename T, typename... Ts>
+    struct map_index_result<Function, std::index_sequence<>, T, Ts...>
+    {
+      using type = std::remove_cvref_t<T>;
+    };
+  }
+
+  namespace result
+  {
+    template<typename Function, product_type T, sized_product_type<size<T>::value>... Ts>
+    struct map_index
+    {
+      using type = typename detail::map_index_result< std::decay_t<Function>
+                                                    , std::make_index_sequence<size<T>::value>
+                                                    , T, Ts...
+                                                    >::type;
+    };
+
+    template<typename Function, product_type T, sized_product_type<size<T>::value>... Ts>
+    using map_index_t = typename map_index<Function,T,Ts...>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,283 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_MINMAX_HPP_INCLUDED
+#define KUMI_ALGORITHM_MINMAX_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/algorithm/flatten.hpp>
+#include <kumi/algorithm/fold.hpp>
+#include <kumi/detail/homogeneous.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the maximum value of applications of f to all elements of t.
+  //! @param t Tuple to inspect
+  //! @param f Unary Callable object
+  //! @return The maximum value of f over all elements of t
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<typename T, typename F> struct max;
+  //!
+  //!   template<typename T, typename F>
+  //!   using max_t = typename max<T, F>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the type returned by a call to kumi::max.
+  //!
+  //! ## Example:
+  //! @include doc/max.cpp
+  //================================================================================================
+  template<typename T, typename F>
+  [[nodiscard]] constexpr auto max(T const& t, F f) noexcept
+  {
+    if constexpr ( !kumi::product_type<T> ) return f(t);
+    else if constexpr( T::size() == 1 )     return f( get<0>(t) );
+    else
+    {
+#if defined(__GNUC__)
+      if constexpr( detail::simd_reducible<T,F> )
+      {
+        if(!std::is_constant_evaluated())
+          return detail::simd_reduce<true>(detail::project(t, f));
+      }
+#endif
+
+      auto base = f( get<0>(t) );
+      return kumi::fold_left( [f]<typename U>(auto cur, U const& u)
+                              {
+                                return cur > f(u) ? cur : f(u);
+                              }
+                            , t, base
+                            );
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the maximum value of applications of f to all elements of kumi::flatten_all(t).
+  //! @param t Tuple to inspect
+  //! @param f Unary Callable object
+  //! @return The maximum value of f over all elements of a flattened version of t
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<typename T, typename F> struct max_flat;
+  //!
+  //!   template<typename T, typename F>
+  //!   using max_flat_t = typename max_flat<T, F>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the type returned by a call to kumi::max_flat.
+  //!
+  //! ## Example:
+  //! @include doc/max_flat.cpp
+  //================================================================================================
+  template<typename T, typename F>
+  [[nodiscard]] constexpr auto max_flat(T const& t, F f) noexcept
+  {
+    if constexpr ( !kumi::product_type<T> ) return f(t);
+    else
+    {
+      return kumi::max( kumi::flatten_all(t, f), [](auto const& m) { return m; } );
+    }
+  }
+
+  namespace detail
+  {
+    template<typename T> T prvalue() noexcept;
+
+    // Types successively taken by the accumulator of kumi::max and kumi::min, which keeps either
+    // its current value or f applied to the next element
+    template<typename Function, typename Acc, typename... Ts> struct extremum_types
+    {
+      using type = Acc;
+    };
+
+    template<typename Function, typename Acc, typename T, typename... Ts>
+    struct extremum_types<Function, Acc, T, Ts...>
+         : extremum_types < Function
+                          , std::decay_t<decltype ( true  ? std::declval<Acc&>()
+                                                          : prvalue < std::invoke_result_t
+                                                                      < Function const&
+                                                                      , std::remove_cvref_t<T> const&
+                                                                      >
+                                                                    >()
+                                                  )
+                                        >
+                          , Ts...
+                          >
+    {};
+
+    template<typename T, typename F, typename Seq = void> struct extremum_result
+    {
+      using type = std::decay_t<std::invoke_result_t<F&, T const&>>;
+    };
+
+    template<product_type T, typename F> struct extremum_result<T, F, void>
+         : extremum_result<T, F, std::make_index_sequence<size<T>::value>>
+    {};
+
+    template<typename T, typename F> struct extremum_result<T, F, std::index_sequence<0>>
+    {
+      using type = std::decay_t<std::invoke_result_t<F&, get_result_t<0, T const&>>>;
+    };
+
+    // Elements are combined from the last one, as in kumi::fold_left
+    template<typename T, typename F, std::size_t... I>
+    struct extremum_result<T, F, std::index_sequence<I...>>
+    {
+      using base = typename extremum_result<T, F, std::index_sequence<0>>::type;
+      using type = typename extremum_types<F, base, element_t<sizeof...(I) - 1 - I, T>...>::type;
+    };
+
+    struct identity_value
+    {
+      template<typename T> constexpr T operator()(T const& m) const noexcept { return m; }
+    };
+
+    template<typename T, typename F> struct extremum_flat_result
+    {
+      using type = std::decay_t<std::invoke_result_t<F&, T const&>>;
+    };
+
+    template<product_type T, typename F> struct extremum_flat_result<T, F>
+    {
+      using flat_t = typename flatten_all_result<T const&, F&>::type;
+      using type   = typename extremum_result<flat_t, identity_value>::type;
+    };
+  }
+
+  namespace result
+  {
+    template<typename T, typename F> struct max
+    {
+      using type = typename detail::extremum_result<std::remove_cvref_t<T>, std::decay_t<F>>::type;
+    };
+
+    template<typename T, typename F> struct max_flat
+    {
+      using type = typename detail::extremum_flat_result< std::remove_cvref_t<T>
+                                                        , std::decay_t<F>
+                                                        >::type;
+    };
+
+    template<typename T, typename F> using max_t      = typename max<T,F>::type;
+    template<typename T, typename F> using max_flat_t = typename max_flat<T,F>::type;
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the minimum value of applications of f to all elements of t.
+  //! @param t Tuple to inspect
+  //! @param f Unary Callable object
+  //! @return The minimum value of f over all elements of t
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<typename T, typename F> struct min;
+  //!
+  //!   template<typename T, typename F>
+  //!   using min_t = typename min<T, F>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the type returned by a call to kumi::min.
+  //!
+  //! ## Example:
+  //! @include doc/min.cpp
+  //================================================================================================
+  template<typename T, typename F>
+  [[nodiscard]] constexpr auto min(T const& t, F f) noexcept
+  {
+    if constexpr ( !kumi::product_type<T> ) return f(t);
+    else if constexpr( T::size() == 1 )     return f( get<0>(t) );
+    else
+    {
+#if defined(__GNUC__)
+      if constexpr( detail::simd_reducible<T,F> )
+      {
+        if(!std::is_constant_evaluated())
+          return detail::simd_reduce<false>(detail::project(t, f));
+      }
+#endif
+
+      auto base = f( get<0>(t) );
+      return kumi::fold_left( [f]<typename U>(auto cur, U const& u)
+                              {
+                                return cur < f(u) ? cur : f(u);
+                              }
+                            , t, base
+                            );
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the minimum value of applications of f to all elements of kumi::flatten_all(t).
+  //! @param t Tuple to inspect
+  //! @param f Unary Callable object
+  //! @return The minimum value of f over all elements of a flattened version of t
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<typename T, typename F> struct min_flat;
+  //!
+  //!   template<typename T, typename F>
+  //!   using min_flat_t = typename min_flat<T, F>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the type returned by a call to kumi::min_flat.
+  //!
+  //! ## Example:
+  //! @include doc/min_flat.cpp
+  //================================================================================================
+  template<typename T, typename F>
+  [[nodiscard]] constexpr auto min_flat(T const& t, F f) noexcept
+  {
+    if constexpr ( !kumi::product_type<T> ) return f(t);
+    else
+    {
+      return kumi::min( kumi::flatten_all(t, f), [](auto const& m) { return m; } );
+    }
+  }
+
+  namespace result
+  {
+    // kumi::min keeps values of the same types as kumi::max
+    template<typename T, typename F> struct min
+    {
+      using type = typename detail::extremum_result<std::remove_cvref_t<T>, std::decay_t<F>>::type;
+    };
+
+    template<typename T, typename F> struct min_flat
+    {
+      using type = typename detail::extremum_flat_result< std::remove_cvref_t<T>
+                                                        , std::decay_t<F>
+                                                        >::type;
+    };
+
+    template<typename T, typename F> using min_t      = typename min<T,F>::type;
+    template<typename T, typename F> using min_flat_t = typename min_flat<T,F>::type;
+  }
+}
+
+#endif
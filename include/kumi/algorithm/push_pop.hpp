@@ -0,0 +1,211 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_PUSH_POP_HPP_INCLUDED
+#define KUMI_ALGORITHM_PUSH_POP_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Constructs a tuple by adding a value v at the beginning of t
+  //!
+  //! If t is an rvalue, its elements are moved into the result.
+  //!
+  //! @param t Base tuple
+  //! @param v Value to insert in front of t
+  //! @return A tuple composed of v followed by all elements of t in order.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple, typename T> struct push_front;
+  //!
+  //!   template<product_type Tuple, typename T>
+  //!   using push_front_t = typename push_front<Tuples...>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::push_front
+  //!
+  //! ## Example
+  //! @include doc/push_front.cpp
+  //================================================================================================
+  template<product_type Tuple, typename T>
+  [[nodiscard]] constexpr auto push_front(Tuple&& t, T&& v)
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return kumi::make_tuple(KUMI_FWD(v), get<I>(KUMI_FWD(t))...);
+    }
+    (std::make_index_sequence<size<Tuple>::value>());
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Remove the first (if any) element of a kumi::product_type.
+  //!
+  //! If t is an rvalue, its elements are moved into the result.
+  //!
+  //! @param t Base tuple
+  //! @return A tuple composed of all elements of t except its first. Has no effect on empty t.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct pop_front;
+  //!
+  //!   template<product_type Tuple>
+  //!   using pop_front_t = typename pop_front<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::pop_front
+  //!
+  //! ## Example
+  //! @include doc/pop_front.cpp
+  //================================================================================================
+  template<product_type Tuple>
+  [[nodiscard]] constexpr auto pop_front(Tuple&& t)
+  {
+    if constexpr(size<Tuple>::value>0)
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return kumi::tuple<element_t<I+1,Tuple>...>{get<I+1>(KUMI_FWD(t))...};
+      }
+      (std::make_index_sequence<size<Tuple>::value-1>());
+    }
+    else return tuple<>{};
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Constructs a tuple by adding a value v at the end of t
+  //!
+  //! If t is an rvalue, its elements are moved into the result.
+  //!
+  //! @param t Base tuple
+  //! @param v Value to insert in front of t
+  //! @return A tuple composed of all elements of t in order followed by v.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple, typename T> struct push_back;
+  //!
+  //!   template<product_type Tuple, typename T>
+  //!   using push_back_t = typename push_back<Tuple,T>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::push_back
+  //!
+  //! ## Example
+  //! @include doc/push_back.cpp
+  //================================================================================================
+  template<product_type Tuple, typename T>
+  [[nodiscard]] constexpr auto push_back(Tuple&& t, T&& v)
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return kumi::make_tuple(get<I>(KUMI_FWD(t))..., KUMI_FWD(v));
+    }
+    (std::make_index_sequence<size<Tuple>::value>());
+  }
+
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Remove the last (if any) element of a kumi::product_type.
+  //!
+  //! If t is an rvalue, its elements are moved into the result.
+  //!
+  //! @param t Base tuple
+  //! @return A tuple composed of all elements of t except its last. Has no effect on empty t.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct pop_back;
+  //!
+  //!   template<product_type Tuple>
+  //!   using pop_back_t = typename pop_back<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::pop_back
+  //!
+  //! ## Example
+  //! @include doc/pop_back.cpp
+  //================================================================================================
+  template<product_type Tuple>
+  [[nodiscard]] constexpr auto pop_back(Tuple&& t)
+  {
+    if constexpr(size<Tuple>::value>1)
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return kumi::tuple<element_t<I,Tuple>...>{get<I>(KUMI_FWD(t))...};
+      }
+      (std::make_index_sequence<size<Tuple>::value-1>());
+    }
+    else return tuple<>{};
+  }
+
+  namespace result
+  {
+    template<product_type Tuple, typename T> struct push_front
+    {
+      using type = detail::cat_types_t< kumi::tuple<std::unwrap_ref_decay_t<T>>
+                                      , detail::elements_t<Tuple, std::unwrap_ref_decay>
+                                      >;
+    };
+
+    template<product_type Tuple> struct pop_front
+    {
+      using type = detail::extract_t< Tuple, 1
+                                    , (size<Tuple>::value > 0 ? size<Tuple>::value - 1 : 0)
+                                    >;
+    };
+
+    template<product_type Tuple, typename T> struct push_back
+    {
+      using type = detail::cat_types_t< detail::elements_t<Tuple, std::unwrap_ref_decay>
+                                      , kumi::tuple<std::unwrap_ref_decay_t<T>>
+                                      >;
+    };
+
+    template<product_type Tuple> struct pop_back
+    {
+      using type = detail::extract_t< Tuple, 0
+                                    , (size<Tuple>::value > 1 ? size<Tuple>::value - 1 : 0)
+                                    >;
+    };
+
+    template<product_type Tuple, typename T>
+    using push_front_t  = typename push_front<Tuple, T>::type;
+
+    template<product_type Tuple>
+    using pop_front_t  = typename pop_front<Tuple>::type;
+
+    template<product_type Tuple, typename T>
+    using push_back_t  = typename push_back<Tuple, T>::type;
+
+    template<product_type Tuple>
+    using pop_back_t  = typename pop_back<Tuple>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,166 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_REDUCE_HPP_INCLUDED
+#define KUMI_ALGORITHM_REDUCE_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/algorithm/fold.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  namespace detail
+  {
+    // Reduces the elements in [Lo, Hi[ by splitting them in up to K balanced groups
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple>
+    constexpr auto tree_reduce(Function& f, Tuple&& t)
+    {
+      if constexpr(Hi - Lo == 1) return get<Lo>(KUMI_FWD(t));
+      else
+      {
+        constexpr std::size_t step  = (Hi - Lo + K - 1) / K;
+        constexpr std::size_t count = (Hi - Lo + step - 1) / step;
+
+        return [&]<std::size_t... C>(std::index_sequence<C...>)
+        {
+          return (... << detail::foldable { f
+                                          , tree_reduce < K, Lo + C*step
+                                                        , (Lo + (C+1)*step < Hi ? Lo + (C+1)*step : Hi)
+                                                        >(f, KUMI_FWD(t))
+                                          }
+                 ).value;
+        }(std::make_index_sequence<count>{});
+      }
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup reductions
+  //! @brief Computes the generalized sum of all elements using a balanced tree of operations.
+  //!
+  //! Elements are split in up to `K` groups of similar sizes which are reduced recursively before
+  //! their results are combined from left to right. Contrary to kumi::fold_left, the operations
+  //! on different groups do not depend on each other, which exposes instruction-level parallelism
+  //! and, for floating-point sums, reduces the accumulated rounding error.
+  //!
+  //! @note The result is equal to the one of kumi::fold_left only if f is associative.
+  //!
+  //! @tparam K     Maximal number of groups combined at each level of the tree. Defaults to 2.
+  //! @param  f     Binary associative callable function to apply
+  //! @param  t     Tuple to operate on
+  //! @param  init  Initial value of the sum
+  //! @return For `K == 2`, the value of
+  //!         `f(init, f( f(...f(get<0>(t), get<1>(t))...), f(...f(get<N-2>(t), get<N-1>(t))...) ))`
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type Tuple, typename Value, std::size_t K = 2>
+  //!   struct reduce;
+  //!
+  //!   template<typename Function, product_type Tuple, typename Value, std::size_t K = 2>
+  //!   using reduce_t = typename reduce<Function,Tuple,Value,K>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::reduce<K>
+  //!
+  //! ## Example
+  //! @include doc/reduce.cpp
+  //================================================================================================
+  template<std::size_t K = 2, typename Function, product_type Tuple, typename Value>
+  requires(K >= 2)
+  [[nodiscard]] constexpr auto reduce(Function f, Tuple&& t, Value init)
+  {
+    if constexpr(size<Tuple>::value == 0) return init;
+    else return f(init, detail::tree_reduce<K, 0, size<Tuple>::value>(f, KUMI_FWD(t)));
+  }
+
+  namespace detail
+  {
+    // Type returned by detail::tree_reduce<K,Lo,Hi>
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple>
+    struct tree_reduce_result;
+
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple
+            , typename Groups
+            >
+    struct tree_reduce_groups;
+
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple
+            , std::size_t... C
+            >
+    struct tree_reduce_groups<K, Lo, Hi, Function, Tuple, std::index_sequence<C...>>
+    {
+      static constexpr std::size_t step = (Hi - Lo + K - 1) / K;
+
+      using type = std::decay_t < typename fold_types
+                                  < Function
+                                  , typename tree_reduce_result
+                                    < K, Lo + C*step
+                                    , (Lo + (C+1)*step < Hi ? Lo + (C+1)*step : Hi)
+                                    , Function, Tuple
+                                    >::type...
+                                  >::type
+                                >;
+    };
+
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple>
+    struct tree_reduce_result
+    {
+      static constexpr std::size_t step  = (Hi - Lo + K - 1) / K;
+      static constexpr std::size_t count = (Hi - Lo + step - 1) / step;
+
+      using type = typename tree_reduce_groups< K, Lo, Hi, Function, Tuple
+                                              , std::make_index_sequence<count>
+                                              >::type;
+    };
+
+    template<std::size_t K, std::size_t Lo, std::size_t Hi, typename Function, typename Tuple>
+    requires(Hi - Lo == 1)
+    struct tree_reduce_result<K, Lo, Hi, Function, Tuple>
+    {
+      using type = std::decay_t<get_result_t<Lo,Tuple>>;
+    };
+
+    template< std::size_t K, typename Function, typename Tuple, typename Value
+            , std::size_t N = size<Tuple>::value
+            >
+    struct reduce_result
+    {
+      using tree = typename tree_reduce_result<K, 0, N, Function, Tuple>::type;
+      using type = std::decay_t<std::invoke_result_t<Function&, Value&, tree>>;
+    };
+
+    template<std::size_t K, typename Function, typename Tuple, typename Value>
+    struct reduce_result<K, Function, Tuple, Value, 0>
+    {
+      using type = Value;
+    };
+  }
+
+  namespace result
+  {
+    template<typename Function, product_type Tuple, typename Value, std::size_t K = 2>
+    requires(K >= 2)
+    struct reduce
+    {
+      using type = typename detail::reduce_result < K, std::decay_t<Function>, Tuple
+                                                  , std::decay_t<Value>
+                                                  >::type;
+    };
+
+    template<typename Function, product_type Tuple, typename Value, std::size_t K = 2>
+    using reduce_t = typename reduce<Function,Tuple,Value,K>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
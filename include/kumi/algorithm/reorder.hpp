@@ -0,0 +1,65 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_REORDER_HPP_INCLUDED
+#define KUMI_ALGORITHM_REORDER_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Reorder elements of a kumi::product_type
+  //!
+  //! This function does not participate in overload resolution if any IDx is outside [0, size_v<T>[.
+  //!
+  //! @note Nothing prevent the number of reordered index to be lesser or greater than t size or
+  //!       the fact they can appear multiple times.
+  //!
+  //! @tparam Idx Reordered index of elements
+  //! @param  t kumi::product_type to reorder
+  //! @return A tuple equivalent to kumi::make_tuple(t[index<Idx>]...);
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple,std::size_t... Idx> struct reorder;
+  //!
+  //!   template<product_type Tuple,std::size_t... Idx>
+  //!   using reorder_t = typename reorder<Tuple,Idx...>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::reorder
+  //!
+  //! ## Example
+  //! @include doc/reorder.cpp
+  //================================================================================================
+  template<std::size_t... Idx, product_type Tuple>
+  requires((Idx < size<Tuple>::value) && ...) [[nodiscard]] constexpr auto reorder(Tuple &&t)
+  {
+    return kumi::make_tuple(KUMI_FWD(t)[index<Idx>]...);
+  }
+
+  namespace result
+  {
+    template<product_type Tuple, std::size_t... Idx>
+    struct reorder
+    {
+      using type = kumi::tuple<std::unwrap_ref_decay_t<element_t<Idx,Tuple>>...>;
+    };
+
+    template<product_type Tuple, std::size_t... Idx>
+    using reorder_t = typename reorder<Tuple,Idx...>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
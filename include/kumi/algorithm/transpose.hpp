@@ -0,0 +1,102 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_TRANSPOSE_HPP_INCLUDED
+#define KUMI_ALGORITHM_TRANSPOSE_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Transpose a tuple of tuples by shifting elements in their transposed position
+  //!
+  //! @param t Tuple to transpose
+  //! @return A tuple containing the transposed elements of t.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct transpose;
+  //!
+  //!   template<product_type Tuple>
+  //!   using transpose_t = typename transpose<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::transpose
+  //!
+  //! ## Example
+  //! @include doc/transpose.cpp
+  //================================================================================================
+  template<product_type Tuple> [[nodiscard]] constexpr auto transpose(Tuple&& t)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return t;
+    else
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        [[maybe_unused]] constexpr auto uz = []<typename N, typename U>(N const &, U&& u) {
+          return apply( [](auto&&... m) { return kumi::make_tuple(get<N::value>(KUMI_FWD(m))...); }
+                      , KUMI_FWD(u)
+                      );
+        };
+
+        // Each column only moves out its own elements from the rows
+        return kumi::make_tuple(uz(index_t<I> {}, KUMI_FWD(t))...);
+      }
+      (std::make_index_sequence<size<element_t<0,Tuple>>::value>());
+    }
+  }
+
+  namespace detail
+  {
+    template<typename Tuple, std::size_t I, typename Rows> struct transpose_column;
+
+    template<typename Tuple, std::size_t I, std::size_t... R>
+    struct transpose_column<Tuple, I, std::index_sequence<R...>>
+    {
+      using type = kumi::tuple< std::unwrap_ref_decay_t
+                                < element_t<I, std::remove_cvref_t<element_t<R,Tuple>>>
+                                >...
+                              >;
+    };
+
+    template<typename Tuple, typename Columns = void> struct transpose_result
+    {
+      using type = std::remove_cvref_t<Tuple>;
+    };
+
+    template<sized_product_type_or_more<1> Tuple> struct transpose_result<Tuple, void>
+         : transpose_result<Tuple, std::make_index_sequence<size<element_t<0,Tuple>>::value>>
+    {};
+
+    template<typename Tuple, std::size_t... I>
+    struct transpose_result<Tuple, std::index_sequence<I...>>
+    {
+      using rows = std::make_index_sequence<size<Tuple>::value>;
+      using type = kumi::tuple<typename transpose_column<Tuple, I, rows>::type...>;
+    };
+  }
+
+  namespace result
+  {
+    template<product_type Tuple> struct transpose
+    {
+      using type = typename detail::transpose_result<Tuple>::type;
+    };
+
+    template<product_type Tuple>
+    using transpose_t = typename transpose<Tuple>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
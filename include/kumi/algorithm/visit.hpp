@@ -0,0 +1,129 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_VISIT_HPP_INCLUDED
+#define KUMI_ALGORITHM_VISIT_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <cassert>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  namespace detail
+  {
+    template<std::size_t I, typename Function>
+    constexpr decltype(auto) invoke_at_index(Function&& f)
+    {
+      return KUMI_FWD(f)(index<I>);
+    }
+
+    template<typename Function, std::size_t... I>
+    concept same_result_at_index = requires
+    {
+      requires (std::same_as< std::invoke_result_t<Function, index_t<0>>
+                            , std::invoke_result_t<Function, index_t<I>>
+                            > && ...);
+    };
+
+    template<typename Function, std::size_t N>
+    concept index_visitor = (N > 0) && []<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return same_result_at_index<Function, I...>;
+    }(std::make_index_sequence<N>{});
+
+    template<typename Function, typename Tuple, std::size_t... I>
+    concept same_result_at_element = requires
+    {
+      requires (std::same_as< std::invoke_result_t<Function, decltype(get<0>(std::declval<Tuple>()))>
+                            , std::invoke_result_t<Function, decltype(get<I>(std::declval<Tuple>()))>
+                            > && ...);
+    };
+
+    template<typename Function, typename Tuple>
+    concept element_visitor =   sized_product_type_or_more<Tuple,1>
+                            &&  []<std::size_t... I>(std::index_sequence<I...>)
+                                {
+                                  return same_result_at_element<Function, Tuple, I...>;
+                                }(std::make_index_sequence<size<Tuple>::value>{});
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief  Invokes f with the compile-time index matching a runtime index.
+  //!
+  //! Dispatches to `f(kumi::index<I>)` where `I == i` through a table of function pointers built
+  //! at compile time, so the cost of the call does not depend on `N`.
+  //!
+  //! @note This function does not take part in overload resolution if `N` is 0 or if `f` does not
+  //!       return the same type for every kumi::index_t in `[0, N[`.
+  //!
+  //! @pre  `i < N`
+  //! @tparam N Number of possible indexes
+  //! @param  i Runtime index to convert. `i` must be less than `N`, which is checked by an
+  //!           assertion. Values like the result of kumi::locate, which is `N` if no element
+  //!           matches, must be checked before being passed.
+  //! @param  f Callable object taking a kumi::index_t
+  //! @return The result of `f(kumi::index<I>)` with `I == i`.
+  //!
+  //! ## Example:
+  //! @include doc/with_index.cpp
+  //================================================================================================
+  template<std::size_t N, typename Function>
+  requires detail::index_visitor<Function, N>
+  constexpr decltype(auto) with_index(std::size_t i, Function&& f)
+  {
+    using result_t = std::invoke_result_t<Function, index_t<0>>;
+
+    return [&]<std::size_t... I>(std::index_sequence<I...>) -> result_t
+    {
+      constexpr result_t (*table[])(Function&&) = { &detail::invoke_at_index<I,Function>... };
+      assert(i < N && "kumi::with_index: index out of range");
+      return table[i](KUMI_FWD(f));
+    }(std::make_index_sequence<N>{});
+  }
+
+  //================================================================================================
+  //! @ingroup queries
+  //! @brief  Invokes f on the element of t at a runtime index.
+  //!
+  //! Dispatches to `f(get<I>(t))` where `I == i` in constant time. Combined with kumi::locate,
+  //! this gives access to the first element satisfying a predicate.
+  //!
+  //! @note This function does not take part in overload resolution if `t` is empty or if `f` does
+  //!       not return the same type for every element of `t`.
+  //!
+  //! @pre  `i < kumi::size<Tuple>::value`
+  //! @param  t kumi::product_type to access
+  //! @param  i Runtime index of the element to access. `i` must be less than the size of `t`,
+  //!           which is checked by an assertion. The result of kumi::locate, which is the size
+  //!           of `t` if no element matches, must be checked before being passed.
+  //! @param  f Callable object invoked on the selected element
+  //! @return The result of `f(get<I>(t))` with `I == i`.
+  //!
+  //! @see kumi::with_index
+  //!
+  //! ## Example:
+  //! @include doc/visit_at.cpp
+  //================================================================================================
+  template<product_type Tuple, typename Function>
+  requires detail::element_visitor<Function, Tuple>
+  constexpr decltype(auto) visit_at(Tuple&& t, std::size_t i, Function&& f)
+  {
+    return kumi::with_index<size<Tuple>::value>
+          ( i
+          , [&](auto n) -> decltype(auto)
+            {
+              return KUMI_FWD(f)(get<decltype(n)::value>(KUMI_FWD(t)));
+            }
+          );
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,90 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_ALGORITHM_ZIP_HPP_INCLUDED
+#define KUMI_ALGORITHM_ZIP_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/algorithm/map.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup generators
+  //! @brief Constructs a tuple where the ith element is the tuple of all ith elements of ts...
+  //!
+  //! @param t0 Tuple to convert
+  //! @param ts Tuples to convert
+  //! @return The tuple of all combination of elements from t0, ts...
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<product_type Tuple> struct zip;
+  //!
+  //!   template<product_type Tuple>
+  //!   using zip_t = typename zip<Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::zip
+  //!
+  //! ## Example
+  //! @include doc/zip.cpp
+  //================================================================================================
+  template<product_type T0, sized_product_type<size_v<T0>>... Ts>
+  [[nodiscard]] constexpr auto zip(T0&& t0, Ts&&... tuples)
+  {
+    return kumi::map( [](auto&& m0, auto&&... ms)
+                      {
+                        return kumi::make_tuple(KUMI_FWD(m0), KUMI_FWD(ms)...);
+                      }
+                    , KUMI_FWD(t0)
+                    , KUMI_FWD(tuples)...
+                    );
+  }
+
+  namespace detail
+  {
+    template<typename Seq, typename T0, typename... Ts> struct zip_result;
+
+    template<std::size_t... I, typename T0, typename... Ts>
+    struct zip_result<std::index_sequence<I...>, T0, Ts...>
+    {
+      template<std::size_t N>
+      using row_t = kumi::tuple < std::unwrap_ref_decay_t<element_t<N,T0>>
+                                , std::unwrap_ref_decay_t<element_t<N,Ts>>...
+                                >;
+
+      using type = kumi::tuple<row_t<I>...>;
+    };
+
+    template<typename T0, typename... Ts> struct zip_result<std::index_sequence<>, T0, Ts...>
+    {
+      using type = std::remove_cvref_t<T0>;
+    };
+  }
+
+  namespace result
+  {
+    template<product_type T0, product_type... Ts>
+    struct zip
+    {
+      using type = typename detail::zip_result< std::make_index_sequence<size<T0>::value>
+                                              , T0, Ts...
+                                              >::type;
+    };
+
+    template<product_type T0, product_type... Ts>
+    using zip_t = typename zip<T0,Ts...>::type;
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
@@ -0,0 +1,254 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_COMPACT_TUPLE_HPP_INCLUDED
+#define KUMI_COMPACT_TUPLE_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/detail/macros.hpp>
+
+namespace kumi
+{
+  namespace detail
+  {
+    // Computes a storage order of Ts sorted by decreasing alignment, stable w.r.t declaration order
+    template<typename... Ts> struct compact_layout
+    {
+      static constexpr auto map = []()
+      {
+        // size is at least 1 so MSVC don't cry when we use a 0-sized array
+        struct { std::size_t slot[sizeof...(Ts)+1], position[sizeof...(Ts)+1]; } that{};
+        std::size_t align[] = { alignof(leaf<0,Ts>)..., 0 };
+
+        for(std::size_t i=0;i<sizeof...(Ts);++i)
+        {
+          std::size_t j = i;
+          while(j > 0 && align[that.slot[j-1]] < align[i])
+          {
+            that.slot[j] = that.slot[j-1];
+            --j;
+          }
+          that.slot[j] = i;
+        }
+
+        for(std::size_t p=0;p<sizeof...(Ts);++p) that.position[that.slot[p]] = p;
+
+        return that;
+      }();
+    };
+
+    template<typename ISeq, typename... Ts> struct compact_storage;
+
+    template<typename T, typename... Us> inline constexpr bool is_self = false;
+
+    template<typename T, typename U>
+    inline constexpr bool is_self<T,U> = std::same_as<std::remove_cvref_t<U>,T>;
+
+    template<std::size_t... P, typename... Ts>
+    struct compact_storage<std::index_sequence<P...>, Ts...>
+    {
+      static constexpr auto map = compact_layout<Ts...>::map;
+      using type = kumi::tuple<typename element_at<map.slot[P], Ts...>::type...>;
+    };
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @class compact_tuple
+  //! @brief Fixed-size collection of heterogeneous values with padding-minimizing storage.
+  //!
+  //! kumi::compact_tuple stores its elements sorted by decreasing alignment so that the padding
+  //! between them is minimized. Elements are still accessed in declaration order, so
+  //! kumi::compact_tuple can be used everywhere a kumi::product_type is expected, including
+  //! structured bindings.
+  //!
+  //! Contrary to kumi::tuple, kumi::compact_tuple is not an aggregate and is initialized through
+  //! its constructor.
+  //!
+  //! @tparam Ts Sequence of types stored inside kumi::compact_tuple.
+  //!
+  //! ## Example:
+  //! @include doc/compact_tuple.cpp
+  //================================================================================================
+  template<typename... Ts> struct compact_tuple
+  {
+    using is_product_type = void;
+    using layout          = detail::compact_layout<Ts...>;
+    using storage_type    = typename detail::compact_storage
+                            < std::make_index_sequence<sizeof...(Ts)>, Ts...>::type;
+    KUMI_NO_UNIQUE_ADDRESS storage_type impl;
+
+    //==============================================================================================
+    //! @name Constructors
+    //! @{
+    //==============================================================================================
+
+    /// Default constructs all elements of a kumi::compact_tuple
+    constexpr compact_tuple() = default;
+
+    //==============================================================================================
+    //! @brief Constructs a kumi::compact_tuple from values given in declaration order
+    //! @param us Values used to initialize each element of the kumi::compact_tuple
+    //==============================================================================================
+    template<typename... Us>
+    requires(   (sizeof...(Us) == sizeof...(Ts)) && (sizeof...(Ts) != 0)
+            &&  (!detail::is_self<compact_tuple, Us...>)
+            &&  (std::constructible_from<Ts, Us&&> && ...)
+            )
+    constexpr compact_tuple(Us&&... us)
+            : impl( [&]<std::size_t... P>(std::index_sequence<P...>)
+                    {
+                      auto args = kumi::forward_as_tuple(KUMI_FWD(us)...);
+                      using args_t = decltype(args);
+                      return storage_type{get<layout::map.slot[P]>(static_cast<args_t&&>(args))...};
+                    }(std::make_index_sequence<sizeof...(Ts)>{})
+                  )
+    {}
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Accessors
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Extracts the Ith element from a kumi::compact_tuple
+    //!
+    //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Ts)).
+    //! @param  i Compile-time index of the element to access in declaration order
+    //! @return A reference to the selected element of current tuple.
+    //==============================================================================================
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) &noexcept
+    {
+      return impl[index<layout::map.position[I]>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) &&noexcept
+    {
+      return static_cast<storage_type &&>(impl)[index<layout::map.position[I]>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) const &&noexcept
+    {
+      return static_cast<storage_type const &&>(impl)[index<layout::map.position[I]>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) const &noexcept
+    {
+      return impl[index<layout::map.position[I]>];
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Properties
+    //! @{
+    //==============================================================================================
+    /// Returns the number of elements in a kumi::compact_tuple
+    [[nodiscard]] static constexpr auto size() noexcept { return sizeof...(Ts); }
+
+    /// Returns `true` if a kumi::compact_tuple contains 0 elements
+    [[nodiscard]] static constexpr bool empty() noexcept { return sizeof...(Ts) == 0; }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Comparison operators
+    //! @{
+    //==============================================================================================
+
+    /// @ingroup tuple
+    /// @related kumi::compact_tuple
+    /// @brief Compares a kumi::compact_tuple with an other kumi::product_type for equality
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator==(compact_tuple const &self, Other const &other) noexcept
+    requires( detail::check_equality<compact_tuple,Other>() )
+    {
+      return kumi::to_ref(self) == other;
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::compact_tuple
+    /// @brief Performs a lexicographical three-way comparison in declaration order
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator<=>(compact_tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<compact_tuple,Other>() )
+    {
+      return kumi::to_ref(lhs) <=> rhs;
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+  };
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::compact_tuple
+  //! @brief kumi::compact_tuple deduction guide
+  //! @tparam Ts  Type lists to build the tuple with.
+  //================================================================================================
+  template<typename... Ts> compact_tuple(Ts &&...) -> compact_tuple<std::unwrap_ref_decay_t<Ts>...>;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Extracts the Ith element from a kumi::compact_tuple
+  //!
+  //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Ts)).
+  //! @tparam   I Compile-time index of the element to access
+  //! @param    t Compile-time index of the element to access
+  //! @return   A reference to the selected element of t.
+  //! @related kumi::compact_tuple
+  //================================================================================================
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(compact_tuple<Ts...> &arg) noexcept
+  {
+    return arg[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(compact_tuple<Ts...> &&arg) noexcept
+  {
+    return static_cast<compact_tuple<Ts...> &&>(arg)[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(compact_tuple<Ts...> const &arg) noexcept
+  {
+    return arg[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(compact_tuple<Ts...> const &&arg) noexcept
+  {
+    return static_cast<compact_tuple<Ts...> const &&>(arg)[index<I>];
+  }
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
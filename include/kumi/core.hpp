@@ -0,0 +1,1311 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_CORE_HPP_INCLUDED
+#define KUMI_CORE_HPP_INCLUDED
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__clang__)
+#  pragma clang diagnostic ignored "-Wmissing-braces"
+#endif
+
+#include <kumi/detail/macros.hpp>
+
+//==================================================================================================
+//! @namespace kumi
+//! @brief Main KUMI namespace
+//==================================================================================================
+namespace kumi
+{
+  //================================================================================================
+  //! @defgroup utility   Helper types and function
+  //! @brief    Tools for interacting with kumi::tuple
+  //!
+  //! @defgroup tuple     Tuple types and function
+  //! @brief    Definition for kumi::tuple class and functions
+  //!
+  //! @defgroup algorithm Tuple Algorithms
+  //! @brief    Algorithms for manipulating kumi::tuple
+  //!
+  //! @ingroup  algorithm
+  //! @{
+  //!   @defgroup transforms Tuple Transformations
+  //!   @brief    Algorithms applying transformation to tuple
+  //!
+  //!   @defgroup queries Tuple Queries
+  //!   @brief    Algorithms querying properties from tuples
+  //!
+  //!   @defgroup reductions Tuple Generalized Reductions
+  //!   @brief    Algorithms performing reductions over tuples
+  //!
+  //!   @defgroup generators Tuple Generators
+  //!   @brief    Algorithms generating tuples
+  //! @}
+  //================================================================================================
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Integral constant type
+  //!
+  //! Defines a integral constant wrapper used to carry compile-time constant through API
+  //================================================================================================
+  template<std::size_t N> struct index_t
+  {
+    /// Value stored by the constant
+    static constexpr auto value = N;
+
+    /// Conversion operator to integer
+    constexpr inline      operator std::size_t() const noexcept { return N; }
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Inline integral constant value for kumi::index_t
+  //================================================================================================
+  template<std::size_t N> inline constexpr index_t<N> const index = {};
+
+  //================================================================================================
+  //! @namespace literals
+  //! @brief KUMI literals namespace
+  //================================================================================================
+  namespace literals
+  {
+    template<char... c> constexpr auto b10()
+    {
+      auto value = 0ULL;
+      ((value = value * 10 + (c - '0')), ...);
+      return value;
+    }
+
+    //==============================================================================================
+    //! @ingroup utility
+    //! @brief Forms a integral constant literal of the desired value.
+    //! @return An instance of kumi::index_t for the specified integral value
+    //! ## Example:
+    //! @include doc/index.cpp
+    //==============================================================================================
+    template<char... c> constexpr auto operator"" _c() noexcept { return index<b10<c...>()>; }
+  }
+
+  namespace detail
+  {
+    //==============================================================================================
+    // Helper concepts
+    //==============================================================================================
+    template<typename From, typename To> struct is_piecewise_constructible;
+    template<typename From, typename To> struct is_piecewise_convertible;
+
+    template<template<class...> class Box, typename... From, typename... To>
+    struct is_piecewise_convertible<Box<From...>, Box<To...>>
+    {
+      static constexpr bool value = (... && std::convertible_to<From, To>);
+    };
+
+    template<template<class...> class Box, typename... From, typename... To>
+    struct is_piecewise_constructible<Box<From...>, Box<To...>>
+    {
+      static constexpr bool value = (... && std::is_constructible_v<To, From>);
+    };
+
+    template<typename From, typename To>
+    concept piecewise_convertible = detail::is_piecewise_convertible<From, To>::value;
+
+    template<typename From, typename To>
+    concept piecewise_constructible = detail::is_piecewise_constructible<From, To>::value;
+
+    template<typename T, typename... Args> concept implicit_constructible = requires(Args... args)
+    {
+      T {args...};
+    };
+
+    template<typename T, typename... Args>
+    concept implicit_move_constructible = requires(Args&&... args)
+    {
+      T { static_cast<Args&&>(args)... };
+    };
+
+    //==============================================================================================
+    // Tuple leaf binder tricks
+    //==============================================================================================
+    template<std::size_t I, typename T> struct leaf
+    {
+      T value;
+    };
+
+    // Empty types don't take any space in the final tuple. Other types are kept as complete
+    // objects so that their tail padding is never reused by the following elements.
+    template<std::size_t I, typename T>
+    requires(std::is_empty_v<T>) struct leaf<I, T>
+    {
+      KUMI_NO_UNIQUE_ADDRESS T value;
+    };
+
+    template<std::size_t I, typename T> constexpr T &get_leaf(leaf<I, T> &arg) noexcept
+    {
+      return arg.value;
+    }
+
+    template<std::size_t I, typename T> constexpr T &&get_leaf(leaf<I, T> &&arg) noexcept
+    {
+      return static_cast<T &&>(arg.value);
+    }
+
+    template<std::size_t I, typename T>
+    constexpr T const &&get_leaf(leaf<I, T> const &&arg) noexcept
+    {
+      return static_cast<T const &&>(arg.value);
+    }
+
+    template<std::size_t I, typename T> constexpr T const &get_leaf(leaf<I, T> const &arg) noexcept
+    {
+      return arg.value;
+    }
+
+    template<typename ISeq, typename... Ts> struct binder;
+
+    template<auto... Is, typename... Ts>
+    struct binder<std::index_sequence<Is...>, Ts...> : leaf<Is, Ts>...
+    {
+    };
+
+    //==============================================================================================
+    // Constant depth type indexing
+    //==============================================================================================
+    template<std::size_t I, typename T> struct typed { using type = T; };
+
+    template<typename ISeq, typename... Ts> struct typelist;
+
+    template<std::size_t... Is, typename... Ts>
+    struct typelist<std::index_sequence<Is...>, Ts...> : typed<Is, Ts>...
+    {
+    };
+
+    template<std::size_t I, typename T> typed<I, T> select(typed<I, T> const&);
+
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define KUMI_HAS_TYPE_PACK_ELEMENT
+#  endif
+#endif
+
+#if defined(KUMI_HAS_TYPE_PACK_ELEMENT)
+    template<std::size_t I, typename... Ts> struct element_at
+    {
+      using type = __type_pack_element<I, Ts...>;
+    };
+#else
+    template<std::size_t I, typename... Ts> struct element_at
+    {
+      using list = typelist<std::make_index_sequence<sizeof...(Ts)>, Ts...>;
+      using type = typename decltype(detail::select<I>(std::declval<list const&>()))::type;
+    };
+#endif
+
+#undef KUMI_HAS_TYPE_PACK_ELEMENT
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Opt-in traits for types behaving like a kumi::product_type
+  //!
+  //! To be treated like a tuple, an user defined type must supports structured bindings opt-in to
+  //! kumi::product_type Semantic.
+  //!
+  //! This can be done in two ways:
+  //!   - exposing an internal `is_product_type` type that evaluates to `void`
+  //!   - specializing the `kumi::is_product_type` traits so it exposes a static constant member
+  //!     `value` that evaluates to `true`
+  //!
+  //! ## Example:
+  //! @include doc/adapt.cpp
+  //==============================================================================================
+  template<typename T, typename Enable = void> struct is_product_type : std::false_type {};
+  template<typename T> struct is_product_type<T, typename T::is_product_type> : std::true_type {};
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Computes the number of elements of a kumi::product_type
+  //!
+  //! @param T kumi::product_type to inspect
+  //!
+  //! ## Helper value
+  //! @code
+  //!   template<typename T> inline constexpr auto size_v = size<T>::value;
+  //! @endcode
+  //================================================================================================
+  template<typename T> struct size : std::tuple_size<T>   {};
+  template<typename T> struct size<T &>         : size<T> {};
+  template<typename T> struct size<T &&>        : size<T> {};
+  template<typename T> struct size<T const>     : size<T> {};
+  template<typename T> struct size<T const &>   : size<T> {};
+  template<typename T> struct size<T const &&>  : size<T> {};
+
+  template<typename T> inline constexpr auto size_v = size<T>::value;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type is non-empty standard tuple-like type.
+  //================================================================================================
+  template<typename T> concept non_empty_tuple = requires( T const &t )
+  {
+    typename std::tuple_element<0,std::remove_cvref_t<T>>::type;
+    typename std::tuple_size<std::remove_cvref_t<T>>::type;
+  };
+
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type is an empty standard tuple-like type.
+  //================================================================================================
+  template<typename T> concept empty_tuple = (std::tuple_size<std::remove_cvref_t<T>>::value == 0);
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type is a standard tuple-like type.
+  //================================================================================================
+  template<typename T> concept std_tuple_compatible = empty_tuple<T> || non_empty_tuple<T>;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type follows the Product Type semantic
+  //!
+  //! A type `T` models `kumi::product_type` if it opts in for the Product Type semantic and
+  //! provides supports for structured bindings.
+  //================================================================================================
+  template<typename T>
+  concept product_type = std_tuple_compatible<T> && is_product_type<std::remove_cvref_t<T>>::value;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type follows the Product Type semantic and has a known size
+  //!
+  //! A type `T` models `kumi::sized_product_type<N>` if it models `kumi::product_type` and has
+  //! exactly `N` elements.
+  //================================================================================================
+  template<typename T, std::size_t N>
+  concept sized_product_type = product_type<T> && (size<T>::value == N);
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type follows the Product Type semantic and has a size lower bound
+  //!
+  //! A type `T` models `kumi::sized_product_type<N>` if it models `kumi::product_type` and has
+  //! at least `N` elements.
+  //================================================================================================
+  template<typename T, std::size_t N>
+  concept sized_product_type_or_more = product_type<T> && (size<T>::value >= N);
+
+  template<typename... Ts> struct tuple;
+  template<typename... Ts> struct compact_tuple;
+}
+
+//==================================================================================================
+// Structured binding adaptation
+//==================================================================================================
+namespace std
+{
+  template<std::size_t I, typename... Ts>
+  struct tuple_element<I, kumi::tuple<Ts...>> : kumi::detail::element_at<I, Ts...>
+  {
+  };
+
+  template<std::size_t I, typename... Ts> struct tuple_element<I, kumi::tuple<Ts...> const>
+  {
+    using type = typename kumi::detail::element_at<I, Ts...>::type const;
+  };
+
+  template<typename... Ts>
+  struct tuple_size<kumi::tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)>
+  {
+  };
+
+  template<std::size_t I, typename... Ts>
+  struct tuple_element<I, kumi::compact_tuple<Ts...>> : kumi::detail::element_at<I, Ts...>
+  {
+  };
+
+  template<std::size_t I, typename... Ts> struct tuple_element<I, kumi::compact_tuple<Ts...> const>
+  {
+    using type = typename kumi::detail::element_at<I, Ts...>::type const;
+  };
+
+  template<typename... Ts>
+  struct tuple_size<kumi::compact_tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)>
+  {
+  };
+}
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Provides indexed access to the types of the elements of a kumi::product_type.
+  //!
+  //! @tparam I Index of the type to retrieve
+  //! @tparam T kumi::product_type to access
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<std::size_t I, typename T> using element_t = typename element<I,T>::type;
+  //! }
+  //! @endcode
+  //================================================================================================
+  template<std::size_t I, typename T> struct element              : std::tuple_element<I,T> {};
+  template<std::size_t I, typename T> struct element<I,T&>        : element<I,T> {};
+  template<std::size_t I, typename T> struct element<I,T&&>       : element<I,T> {};
+  template<std::size_t I, typename T> struct element<I,T const&>  : element<I,T> {};
+  template<std::size_t I, typename T> struct element<I,T const&&> : element<I,T> {};
+
+  template<std::size_t I, typename T> using  element_t = typename element<I,T>::type;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Computes the return type of a call to kumi::get
+  //!
+  //! @tparam I Index of the type to retrieve
+  //! @tparam T kumi::product_type to access
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<std::size_t I, typename T> using member_t = typename member<I,T>::type;
+  //! }
+  //! @endcode
+  //================================================================================================
+  template<std::size_t I, typename T> struct member
+  {
+    using type = decltype( get<I>(std::declval<T&>()));
+  };
+
+  template<std::size_t I, typename T> using  member_t = typename member<I,T>::type;
+
+  namespace detail
+  {
+    template<typename T, typename ISeq> struct is_homogeneous;
+
+    template<typename T, std::size_t... I>
+    struct is_homogeneous<T, std::index_sequence<I...>>
+        : std::bool_constant<(std::same_as<element_t<0,T>, element_t<I,T>> && ...)>
+    {
+    };
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type is a non-empty kumi::product_type whose elements all share
+  //!        the same type.
+  //================================================================================================
+  template<typename T>
+  concept homogeneous_product_type  =   sized_product_type_or_more<T,1>
+                                    &&  detail::is_homogeneous< std::remove_cvref_t<T>
+                                                              , std::make_index_sequence<size<T>::value>
+                                                              >::value;
+
+  //================================================================================================
+  // Type-level helpers for the result traits, so that computing the type returned by an algorithm
+  // does not instantiate its body
+  //================================================================================================
+  namespace detail
+  {
+    template<typename T> inline constexpr bool is_kumi_tuple = false;
+    template<typename... Ts> inline constexpr bool is_kumi_tuple<tuple<Ts...>> = true;
+
+    template<typename T> inline constexpr bool is_kumi_compact_tuple = false;
+    template<typename... Ts> inline constexpr bool is_kumi_compact_tuple<compact_tuple<Ts...>> = true;
+
+    // Type of get<I>(std::declval<T>()), computed without calling get on kumi's own tuples
+    template<std::size_t I, typename T> struct get_result
+    {
+      using type = decltype(get<I>(std::declval<T>()));
+    };
+
+    template<std::size_t I, typename T>
+    requires(is_kumi_tuple<std::remove_cvref_t<T>> || is_kumi_compact_tuple<std::remove_cvref_t<T>>)
+    struct get_result<I,T>
+    {
+      using base  = std::conditional_t< std::is_const_v<std::remove_reference_t<T>>
+                                      , element_t<I,T> const, element_t<I,T>
+                                      >;
+      using type  = std::conditional_t<std::is_lvalue_reference_v<T>, base&, base&&>;
+    };
+
+    template<std::size_t I, typename T> using get_result_t = typename get_result<I,T>::type;
+
+    template< product_type Tuple
+            , typename IndexSequence
+            , template<typename...> class Meta = std::type_identity
+            >
+    struct as_tuple;
+
+    template< product_type Tuple
+            , std::size_t... I
+            >
+    struct as_tuple<Tuple, std::index_sequence<I...>>
+    {
+      using type = kumi::tuple< element_t<I,Tuple>... >;
+    };
+
+    template< product_type Tuple
+            , std::size_t... I
+            , template<typename...> class Meta
+            >
+    struct as_tuple<Tuple, std::index_sequence<I...>, Meta>
+    {
+      using type = kumi::tuple< typename Meta<element_t<I,Tuple>>::type... >;
+    };
+    // kumi::tuple of the element types of a product type, optionally transformed by Meta
+    template<typename T, template<typename...> class Meta = std::type_identity>
+    using elements_t = typename as_tuple< std::remove_cvref_t<T>
+                                        , std::make_index_sequence<size<T>::value>
+                                        , Meta
+                                        >::type;
+
+    // Concatenation of kumi::tuple used as type lists
+    template<typename... Lists> struct cat_types;
+
+    template<> struct cat_types<> { using type = tuple<>; };
+
+    template<typename... T0> struct cat_types<tuple<T0...>> { using type = tuple<T0...>; };
+
+    template<typename... T0, typename... T1, typename... Lists>
+    struct cat_types<tuple<T0...>, tuple<T1...>, Lists...>
+         : cat_types<tuple<T0..., T1...>, Lists...>
+    {};
+
+    template< typename... T0, typename... T1, typename... T2, typename... T3
+            , typename... Lists
+            >
+    struct cat_types<tuple<T0...>, tuple<T1...>, tuple<T2...>, tuple<T3...>, Lists...>
+         : cat_types<tuple<T0..., T1..., T2..., T3...>, Lists...>
+    {};
+
+    template<typename... Lists> using cat_types_t = typename cat_types<Lists...>::type;
+
+    // Type deduced by kumi::tuple{std::declval<Ts>()...}, a single kumi::tuple being copied
+    template<typename... Ts> struct deduced_tuple
+    {
+      using type = tuple<std::unwrap_ref_decay_t<Ts>...>;
+    };
+
+    template<typename T>
+    requires(is_kumi_tuple<std::remove_cvref_t<T>>)
+    struct deduced_tuple<T>
+    {
+      using type = std::remove_cvref_t<T>;
+    };
+
+    template<typename... Ts> using deduced_tuple_t = typename deduced_tuple<Ts...>::type;
+  }
+
+  //================================================================================================
+  // Concept machinery to make our algorithms SFINAE friendly
+  //================================================================================================
+  namespace detail
+  {
+    template<typename F, std::size_t I, typename... Tuples>
+    concept applicable_i = std::is_invocable_v<F, decltype(get<I>(std::declval<Tuples>()))...>;
+
+    template<typename F, typename Indices, typename... Tuples> struct is_applicable;
+
+    template<typename F, std::size_t... Is, typename... Tuples>
+    struct is_applicable<F, std::index_sequence<Is...>, Tuples...>
+        : std::bool_constant<(applicable_i<F, Is, Tuples...> && ...)>
+    {
+    };
+
+    template<typename F, typename... Tuples>
+    concept applicable = detail::
+        is_applicable<F, std::make_index_sequence<(size<Tuples>::value, ...)>, Tuples...>::value;
+
+    // Helper for checking if two tuples can == each others
+    template<typename T, typename U>
+    concept comparable = requires(T t, U u)
+    {
+      { t == u };
+    };
+
+    template<typename T, typename U> constexpr auto check_equality()
+    {
+      return comparable<T,U>;
+    }
+
+    template<product_type T, product_type U>
+    constexpr auto check_equality()
+    {
+      return []<std::size_t...I>(std::index_sequence<I...>)
+      {
+        return (check_equality<member_t<I,T>,member_t<I,U>>() && ...);
+      }(std::make_index_sequence<size<T>::value>{});
+    }
+
+    // Helper for checking if two tuples can be ordered
+    template<typename T, typename U>
+    concept orderable = requires(T t, U u)
+    {
+      { t < u } -> std::convertible_to<bool>;
+      { u < t } -> std::convertible_to<bool>;
+    };
+
+    template<typename T, typename U> constexpr auto check_ordering()
+    {
+      return orderable<T,U>;
+    }
+
+    template<product_type T, product_type U>
+    constexpr auto check_ordering()
+    {
+      return []<std::size_t...I>(std::index_sequence<I...>)
+      {
+        return (check_ordering<member_t<I,T>,member_t<I,U>>() && ...);
+      }(std::make_index_sequence<size<T>::value>{});
+    }
+
+    // Synthesized three-way comparison, see [expos.only.func]
+    inline constexpr auto synth_three_way = []<typename T, typename U>(T const& t, U const& u)
+    {
+      if constexpr(std::three_way_comparable_with<T,U>) return t <=> u;
+      else
+      {
+        if(t < u) return std::weak_ordering::less;
+        if(u < t) return std::weak_ordering::greater;
+        return std::weak_ordering::equivalent;
+      }
+    };
+
+    template<typename T, typename U>
+    using synth_three_way_t = decltype(synth_three_way(std::declval<T&>(), std::declval<U&>()));
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Invoke the Callable object f with a tuple of arguments.
+  //!
+  //! @param f	Callable object to be invoked
+  //! @param t  kumi::product_type whose elements to be used as arguments to f
+  //! @return The value returned by f.
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi::result
+  //! {
+  //!   template<typename Function, product_type Tuple> struct apply;
+  //!
+  //!   template<typename Function, product_type Tuple>
+  //!   using apply_t = typename apply<Function,Tuple>::type;
+  //! }
+  //! @endcode
+  //!
+  //! Computes the return type of a call to kumi::apply
+  //!
+  //! ## Example
+  //! @include doc/apply.cpp
+  //================================================================================================
+  template<typename Function, product_type Tuple>
+  constexpr decltype(auto) apply(Function &&f, Tuple &&t)
+  {
+    if constexpr(sized_product_type<Tuple,0>) return  KUMI_FWD(f)();
+    else
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>) -> decltype(auto)
+      {
+        return KUMI_FWD(f)(get<I>(KUMI_FWD(t))...);
+      }
+      (std::make_index_sequence<size<Tuple>::value>());
+    }
+  }
+
+  namespace detail
+  {
+    template<typename Function, typename Tuple, typename Seq> struct apply_result;
+
+    template<typename Function, typename Tuple, std::size_t... I>
+    struct apply_result<Function, Tuple, std::index_sequence<I...>>
+    {
+      using type = std::invoke_result_t<Function, get_result_t<I,Tuple>...>;
+    };
+  }
+
+  namespace result
+  {
+    template<typename Function, product_type Tuple>
+    struct apply
+    {
+      using type = typename detail::apply_result< Function, Tuple
+                                                , std::make_index_sequence<size<Tuple>::value>
+                                                >::type;
+    };
+
+    template<typename Function, product_type Tuple>
+    using apply_t = typename apply<Function,Tuple>::type;
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @class tuple
+  //! @brief Fixed-size collection of heterogeneous values.
+  //!
+  //! kumi::tuple provides an aggregate based implementation of a tuple. It provides algorithms and
+  //! functions designed to facilitate tuple's handling and transformations.
+  //!
+  //! kumi::tuple is also compatible with standard tuple operations and structured bindings.
+  //!
+  //! @tparam Ts Sequence of types stored inside kumi::tuple.
+  //================================================================================================
+  template<typename... Ts> struct tuple
+  {
+    using is_product_type = void;
+    KUMI_NO_UNIQUE_ADDRESS detail::binder<std::make_index_sequence<sizeof...(Ts)>, Ts...> impl;
+
+    //==============================================================================================
+    //! @name Accessors
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Extracts the Ith element from a kumi::tuple
+    //!
+    //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Ts)).
+    //! @param  i Compile-time index of the element to access
+    //! @return A reference to the selected element of current tuple.
+    //!
+    //! ## Example:
+    //! @include doc/subscript.cpp
+    //==============================================================================================
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) &noexcept
+    {
+      return detail::get_leaf<I>(impl);
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) &&noexcept
+    {
+      return detail::get_leaf<I>(static_cast<decltype(impl) &&>(impl));
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) const &&noexcept
+    {
+      return detail::get_leaf<I>(static_cast<decltype(impl) const &&>(impl));
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) constexpr decltype(auto) operator[](index_t<I>) const &noexcept
+    {
+      return detail::get_leaf<I>(impl);
+    }
+
+    //==============================================================================================
+    //! @brief Extracts a sub-tuple from a kumi::tuple
+    //!
+    //! @note Does not participate in overload resolution if `I0` and `I1` do not verify that
+    //!       `0 <= I0 <= I1 <= sizeof...(Ts)`.
+    //! @param  i0 Compile-time index of the first element to extract.
+    //! @param  i1 Compile-time index past the last element to extract. By default, `i1` is equal to
+    //!         `sizeof...(Ts)`.
+    //! @return A new kumi::tuple containing to the selected elements of current tuple.
+    //!
+    //! ## Example:
+    //! @include doc/extract.cpp
+    //==============================================================================================
+    template<std::size_t I0, std::size_t I1>
+    requires((I1 - I0) <= sizeof...(Ts))
+    [[nodiscard]] constexpr auto extract(index_t<I0> const &, index_t<I1> const &) const& noexcept
+    {
+      return [&]<std::size_t... N>(std::index_sequence<N...>)
+      {
+        return tuple<std::tuple_element_t<N + I0, tuple>...> {(*this)[index<N + I0>]...};
+      }
+      (std::make_index_sequence<I1 - I0>());
+    }
+
+    /// @overload
+    template<std::size_t I0, std::size_t I1>
+    requires((I1 - I0) <= sizeof...(Ts))
+    [[nodiscard]] constexpr auto extract(index_t<I0> const &, index_t<I1> const &) && noexcept
+    {
+      return [&]<std::size_t... N>(std::index_sequence<N...>)
+      {
+        return tuple<std::tuple_element_t<N + I0, tuple>...>
+              { static_cast<tuple&&>(*this)[index<N + I0>]... };
+      }
+      (std::make_index_sequence<I1 - I0>());
+    }
+
+    /// @overload
+    template<std::size_t I0>
+    requires(I0 <= sizeof...(Ts))
+    [[nodiscard]] constexpr auto extract(index_t<I0> const &) const& noexcept
+    {
+      return extract(index<I0>, index<sizeof...(Ts)>);
+    }
+
+    /// @overload
+    template<std::size_t I0>
+    requires(I0 <= sizeof...(Ts))
+    [[nodiscard]] constexpr auto extract(index_t<I0> const &) && noexcept
+    {
+      return static_cast<tuple&&>(*this).extract(index<I0>, index<sizeof...(Ts)>);
+    }
+
+    //==============================================================================================
+    //! @brief Split a tuple into two
+    //!
+    //! Split a kumi::tuple in two kumi::tuple containing all the elements before and after
+    //! a given index.
+    //!
+    //! @note Does not participate in overload resolution if `I0` is not in `[0, sizeof...(Ts)[`.
+    //!
+    //! If the tuple is an rvalue, its elements are moved into the result.
+    //!
+    //! @param  i0 Compile-time index of the first element to extract.
+    //! @return A new kumi::tuple containing the two sub-tuple cut at index I.
+    //!
+    //!
+    //! ## Helper type
+    //! @code
+    //! namespace kumi::result
+    //! {
+    //!   template<std::size_t I0, product_type Tuple> struct split;
+    //!
+    //!   template<std::size_t I0, product_type Tuple>
+    //!   using split_t = typename split<I0,Tuple>::type;
+    //! }
+    //! @endcode
+    //!
+    //! Computes the type returned by a call to split.
+    //!
+    //! ## Example:
+    //! @include doc/split.cpp
+    //==============================================================================================
+    template<std::size_t I0>
+    requires(I0 <= sizeof...(Ts)) [[nodiscard]] constexpr auto split(index_t<I0> const&) const& noexcept;
+
+    /// @overload
+    template<std::size_t I0>
+    requires(I0 <= sizeof...(Ts)) [[nodiscard]] constexpr auto split(index_t<I0> const&) && noexcept;
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Properties
+    //! @{
+    //==============================================================================================
+    /// Returns the number of elements in a kumi::tuple
+    [[nodiscard]] static constexpr auto size() noexcept { return sizeof...(Ts); }
+
+    /// Returns `true` if a kumi::tuple contains 0 elements
+    [[nodiscard]] static constexpr bool empty() noexcept { return sizeof...(Ts) == 0; }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Conversions
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief  Converts a tuple<Ts...> to a tuple<Us...>.
+    //! @tparam Us Types composing the destination tuple
+    //!
+    //! ## Example:
+    //! @include doc/cast.cpp
+    //==============================================================================================
+    template<typename... Us>
+    requires(   detail::piecewise_convertible<tuple, tuple<Us...>>
+            &&  (sizeof...(Us) == sizeof...(Ts))
+            &&  (!std::same_as<Ts, Us> && ...)
+            )
+    [[nodiscard]] inline constexpr auto cast() const
+    {
+      return apply([](auto &&...elems) { return tuple<Us...> {static_cast<Us>(elems)...}; }, *this);
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Replaces the contents of the tuple with the contents of another tuple.
+    //! @param other kumi::tuple to copy or move from
+    //! @return `*this`
+    //==============================================================================================
+    template<typename... Us>
+    requires(detail::piecewise_convertible<tuple, tuple<Us...>>) constexpr tuple &
+    operator=(tuple<Us...> const &other)
+    {
+      [&]<std::size_t... I>(std::index_sequence<I...>) { ((get<I>(*this) = get<I>(other)), ...); }
+      (std::make_index_sequence<sizeof...(Ts)>());
+
+      return *this;
+    }
+
+    /// @overload
+    template<typename... Us>
+    requires(detail::piecewise_convertible<tuple, tuple<Us...>>) constexpr tuple &
+    operator=(tuple<Us...> &&other)
+    {
+      [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        ((get<I>(*this) = get<I>(KUMI_FWD(other))), ...);
+      }
+      (std::make_index_sequence<sizeof...(Ts)>());
+
+      return *this;
+    }
+
+    //==============================================================================================
+    //! @name Comparison operators
+    //! @{
+    //==============================================================================================
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares a tuple with an other kumi::product_type for equality
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator==(tuple const &self, Other const &other) noexcept
+    requires( (sizeof...(Ts) != 0 ) && detail::check_equality<tuple,Other>() )
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return ((get<I>(self) == get<I>(other)) && ...);
+      }
+      (std::make_index_sequence<sizeof...(Ts)>());
+    }
+
+#if !defined(KUMI_DOXYGEN_INVOKED)
+    template<sized_product_type<0> Other>
+    friend constexpr auto operator==(tuple const&, Other const &) noexcept
+    {
+      return true;
+    }
+#endif
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares a tuple with an other kumi::product_type for inequality
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator!=(tuple const &self, Other const &other) noexcept
+    requires( (sizeof...(Ts) != 0 ) && detail::check_equality<tuple,Other>() )
+    {
+      return !(self == other);
+    }
+
+#if !defined(KUMI_DOXYGEN_INVOKED)
+    template<sized_product_type<0> Other>
+    friend constexpr auto operator!=(tuple const&, Other const &) noexcept
+    {
+      return false;
+    }
+#endif
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Performs a lexicographical three-way comparison between a tuple and a product type
+    ///
+    /// Elements are compared in order using `<=>` if available or `<` otherwise. The comparison
+    /// stops at the first pair of elements that are not equivalent.
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator<=>(tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<tuple,Other>() )
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        using result_t = std::common_comparison_category_t
+                        < detail::synth_three_way_t<Ts, element_t<I,Other>>... >;
+
+        result_t res = std::strong_ordering::equal;
+        static_cast<void>
+        ( ( ((res = detail::synth_three_way(get<I>(lhs), get<I>(rhs))) == 0) && ... ) );
+        return res;
+      }
+      (std::make_index_sequence<sizeof...(Ts)>());
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares tuple and product type value for lexicographical is less relation
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator<(tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<tuple,Other>() )
+    {
+      return (lhs <=> rhs) < 0;
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares tuple and product type value for lexicographical is less or equal relation
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator<=(tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<tuple,Other>() )
+    {
+      return (lhs <=> rhs) <= 0;
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares tuple and product type value for lexicographical is greater relation
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator>(tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<tuple,Other>() )
+    {
+      return (lhs <=> rhs) > 0;
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::tuple
+    /// @brief Compares tuple and product type value for lexicographical is greater relation relation
+    template<sized_product_type<sizeof...(Ts)> Other>
+    friend constexpr auto operator>=(tuple const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<tuple,Other>() )
+    {
+      return (lhs <=> rhs) >= 0;
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Invoke the Callable object f on each element of the current tuple.
+    //!
+    //! @param f	Callable object to be invoked
+    //! @return The value returned by f.
+    //!
+    //==============================================================================================
+    template<typename Function>
+    constexpr decltype(auto) operator()(Function &&f) const&
+    noexcept(noexcept(kumi::apply(KUMI_FWD(f), *this))) { return kumi::apply(KUMI_FWD(f), *this); }
+
+#if !defined(KUMI_DOXYGEN_INVOKED)
+    template<typename Function>
+    constexpr decltype(auto) operator()(Function &&f) &
+    noexcept(noexcept(kumi::apply(KUMI_FWD(f), *this)))
+    {
+      return kumi::apply(KUMI_FWD(f), *this);
+    }
+
+    template<typename Function>
+    constexpr decltype(auto) operator()(Function &&f) const &&noexcept(
+    noexcept(kumi::apply(KUMI_FWD(f), static_cast<tuple const &&>(*this))))
+    {
+      return kumi::apply(KUMI_FWD(f), static_cast<tuple const &&>(*this));
+    }
+
+    template<typename Function>
+    constexpr decltype(auto) operator()(Function &&f) &&noexcept(
+    noexcept(kumi::apply(KUMI_FWD(f), static_cast<tuple &&>(*this))))
+    {
+      return kumi::apply(KUMI_FWD(f), static_cast<tuple &&>(*this));
+    }
+#endif
+
+  };
+
+  //================================================================================================
+  //! @name Tuple construction
+  //! @{
+  //================================================================================================
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief kumi::tuple deduction guide
+  //! @tparam Ts  Type lists to build the tuple with.
+  //================================================================================================
+  template<typename... Ts> tuple(Ts &&...) -> tuple<std::unwrap_ref_decay_t<Ts>...>;
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief Creates a kumi::tuple of lvalue references to its arguments.
+  //! @param ts	Zero or more lvalue arguments to construct the tuple from.
+  //! @return A kumi::tuple object containing lvalue references.
+  //! ## Example:
+  //! @include doc/tie.cpp
+  //================================================================================================
+  template<typename... Ts> [[nodiscard]] constexpr tuple<Ts &...> tie(Ts &...ts) { return {ts...}; }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief Creates a kumi::tuple of forwarding references to its arguments.
+  //!
+  //! Constructs a tuple of references to the arguments in args suitable for forwarding as an
+  //! argument to a function. The tuple has rvalue reference data members when rvalues are used as
+  //! arguments, and otherwise has lvalue reference data members.
+  //!
+  //! @note If the arguments are temporaries, `forward_as_tuple` does not extend their lifetime;
+  //!       they have to be used before the end of the full expression.
+  //!
+  //! @param ts	Zero or more lvalue arguments to construct the tuple from.
+  //! @return A kumi::tuple constructed as `kumi::tuple<Ts&&...>(std::forward<Ts>(args)...)`
+  //! ## Example:
+  //! @include doc/forward_as_tuple.cpp
+  //================================================================================================
+  template<typename... Ts> [[nodiscard]] constexpr tuple<Ts &&...> forward_as_tuple(Ts &&...ts)
+  {
+    return {KUMI_FWD(ts)...};
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief Creates a tuple object, deducing the target type from the types of arguments.
+  //!
+  //! @param ts	Zero or more lvalue arguments to construct the tuple from.
+  //! @return A kumi::tuple constructed from the ts or their inner references when ts is an instance
+  //!         of `std::reference_wrapper`.
+  //! ## Example:
+  //! @include doc/make_tuple.cpp
+  //================================================================================================
+  template<typename... Ts>
+  [[nodiscard]] constexpr tuple<std::unwrap_ref_decay_t<Ts>...> make_tuple(Ts &&...ts)
+  {
+    return {KUMI_FWD(ts)...};
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief Creates a kumi::tuple of references given a reference to a kumi::product_type.
+  //!
+  //! @param    t Compile-time index of the element to access
+  //! @return   A tuple equivalent to the result of `kumi::apply([]<typename... T>(T&&... e)
+  //!           { return kumi::forward_as_tuple(std::forward<T>(e)...); }, t)`
+  //!
+  //! ## Example:
+  //! @include doc/to_ref.cpp
+  //================================================================================================
+  template<product_type Type> [[nodiscard]] constexpr auto to_ref(Type&& that)
+  {
+    return apply( [](auto&&... elems)
+                  {
+                    return kumi::forward_as_tuple(KUMI_FWD(elems)...);
+                  }
+                , KUMI_FWD(that)
+                );
+  }
+
+  //================================================================================================
+  //! @}
+  //================================================================================================
+
+  //================================================================================================
+  //! @name Conversions
+  //! @{
+  //================================================================================================
+
+  //================================================================================================
+  //! @brief Converts a kumi::tuple to an instance of an arbitrary type
+  //!
+  //! Constructs an instance of `Type` by passing elements of `t` to the appropriate constructor.
+  //! If `t` is an rvalue, its elements are moved into the constructor.
+  //!
+  //! @tparam Type Type to generate
+  //! @param  t    kumi::tuple to convert
+  //! @return An instance of `Type` constructed from each element of `t` in order.
+  //!
+  //! ## Example
+  //! @include doc/from_tuple.cpp
+  //================================================================================================
+  template<typename Type, typename... Ts>
+  requires(!product_type<Type> && detail::implicit_constructible<Type, Ts...>)
+  [[nodiscard]] constexpr auto from_tuple(tuple<Ts...> const &t)
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) { return Type {get<I>(t)...}; }
+    (std::make_index_sequence<sizeof...(Ts)>());
+  }
+
+  /// @overload
+  template<typename Type, typename... Ts>
+  requires(!product_type<Type> && detail::implicit_move_constructible<Type, Ts...>)
+  [[nodiscard]] constexpr auto from_tuple(tuple<Ts...> &&t)
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return Type {get<I>(static_cast<tuple<Ts...>&&>(t))...};
+    }
+    (std::make_index_sequence<sizeof...(Ts)>());
+  }
+
+  //================================================================================================
+  //! @brief Converts a kumi::product_type to an instance kumi::tuple
+  //!
+  //! Constructs an instance kumi::tuple from the elements of the kumi::product_type parameters
+  //!
+  //! @param  t    kumi::product_type to convert
+  //! @return An instance of kumi::tuple constructed from each elements of `t` in order.
+  //!
+  //! ## Example
+  //! @include doc/to_tuple.cpp
+  //================================================================================================
+  template<product_type Type>
+  [[nodiscard]] inline constexpr auto to_tuple(Type&& t)
+  {
+    return apply([](auto &&...elems) { return tuple{KUMI_FWD(elems)...}; }, KUMI_FWD(t));
+  }
+
+  //================================================================================================
+  //! @}
+  //================================================================================================
+
+  template<typename... Ts>
+  template<std::size_t I0>
+  requires(I0 <= sizeof...(Ts))
+  [[nodiscard]] constexpr auto tuple<Ts...>::split(index_t<I0> const &) const& noexcept
+  {
+    return kumi::make_tuple(extract(index<0>, index<I0>), extract(index<I0>));
+  }
+
+  template<typename... Ts>
+  template<std::size_t I0>
+  requires(I0 <= sizeof...(Ts))
+  [[nodiscard]] constexpr auto tuple<Ts...>::split(index_t<I0> const &) && noexcept
+  {
+    // Each call only moves out the elements it extracts
+    return kumi::make_tuple ( static_cast<tuple&&>(*this).extract(index<0>, index<I0>)
+                            , static_cast<tuple&&>(*this).extract(index<I0>)
+                            );
+  }
+
+  namespace detail
+  {
+    // Type of the kumi::tuple holding the Count elements of T starting at Offset
+    template<typename T, std::size_t Offset, typename Seq> struct extract_result;
+
+    template<typename T, std::size_t Offset, std::size_t... N>
+    struct extract_result<T, Offset, std::index_sequence<N...>>
+    {
+      using type = kumi::tuple<element_t<Offset + N, T>...>;
+    };
+
+    template<typename T, std::size_t Offset, std::size_t Count>
+    using extract_t = typename extract_result<T, Offset, std::make_index_sequence<Count>>::type;
+  }
+
+  namespace result
+  {
+    template<product_type T, std::size_t I0>
+    requires(I0 <= size<T>::value)
+    struct split
+    {
+      using type = kumi::tuple< detail::extract_t<T, 0 , I0>
+                              , detail::extract_t<T, I0, size<T>::value - I0>
+                              >;
+    };
+
+    template<product_type T, std::size_t I0>
+    using split_t = typename split<T,I0>::type;
+  }
+
+  //================================================================================================
+  //! @name Accessors
+  //! @{
+  //================================================================================================
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Extracts the Ith element from a kumi::tuple
+  //!
+  //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Ts)).
+  //! @tparam   I Compile-time index of the element to access
+  //! @param    t Compile-time index of the element to access
+  //! @return   A reference to the selected element of t.
+  //! @related kumi::tuple
+  //!
+  //! ## Example:
+  //! @include doc/get.cpp
+  //================================================================================================
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto) get(tuple<Ts...> &arg) noexcept
+  {
+    return arg[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(tuple<Ts...> &&arg) noexcept
+  {
+    return static_cast<tuple<Ts...> &&>(arg)[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(tuple<Ts...> const &arg) noexcept
+  {
+    return arg[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Ts>
+  requires(I < sizeof...(Ts)) [[nodiscard]] constexpr decltype(auto)
+  get(tuple<Ts...> const &&arg) noexcept
+  {
+    return static_cast<tuple<Ts...> const &&>(arg)[index<I>];
+  }
+
+
+  //================================================================================================
+  //! @}
+  //================================================================================================
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Generate a kumi::tuple type from a kumi::product_type
+  //!
+  //! Compute the exact kumi::tuple type containing the same element as `Tuple`, an arbitrary type
+  //! modeling kumi::product_type. A template meta-function can be optionally passed to be applied
+  //! to each of those types when types are computed.
+  //!
+  //! @tparam Tuple kumi::product_type to tranform
+  //! @tparam Meta  Unary template meta-function to apply to each types.
+  //!               Defaults to `std::type_identity`
+  //!
+  //! ## Helper type
+  //! @code
+  //! namespace kumi
+  //! {
+  //!   template<product_type Tuple, template<typename...> class Meta = std::type_identity>
+  //!   using as_tuple_t = typename as_tuple<Tuple, Meta>::type;
+  //! }
+  //! @endcode
+  //!
+  //! ## Example:
+  //! @include doc/as_tuple.cpp
+  //================================================================================================
+  template<typename Tuple, template<typename...> class Meta = std::type_identity>
+  struct as_tuple : detail::as_tuple< Tuple
+                                    , std::make_index_sequence<kumi::size<Tuple>::value>
+                                    , Meta
+                                    >
+  {};
+
+  template<product_type Tuple, template<typename...> class Meta = std::type_identity>
+  using as_tuple_t =  typename as_tuple<Tuple, Meta>::type;
+}
+
+#include <kumi/detail/undef_macros.hpp>
+#endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_DETAIL_HOMOGENEOUS_HPP_INCLUDED
+#define KUMI_DETAIL_HOMOGENEOUS_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+
+namespace kumi
+{
+  //================================================================================================
+  // Homogeneous fast paths
+  //================================================================================================
+  namespace detail
+  {
+    template<typename T, std::size_t N> struct array_of { T values[N]; };
+
+    // Homogeneous arithmetic product types are processed as contiguous arrays so that the
+    // compiler can vectorize loops over them
+    template<typename T>
+    concept arithmetic_product_type =   homogeneous_product_type<T>
+                                    &&  std::is_arithmetic_v<element_t<0,T>>;
+
+    template<typename T, typename F>
+    using projection_t = std::remove_cvref_t<std::invoke_result_t<F&, element_t<0,T> const&>>;
+
+    template<arithmetic_product_type T, typename F>
+    constexpr auto project(T const& t, F& f)
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return array_of<projection_t<T,F>, size<T>::value>{ f(get<I>(t))... };
+      }(std::make_index_sequence<size<T>::value>{});
+    }
+
+#if defined(__GNUC__)
+    template<typename T, std::size_t N>
+    using vector_t [[gnu::vector_size(N * sizeof(T))]] = T;
+
+    // Product types whose integral projection fits in a native register can be reduced as SIMD
+    // vectors. Floating point projections are excluded as the tree reduction would not pick the
+    // same element as the sequential one for signed zeros, NaN or other equal values.
+    template<typename T, typename F>
+    concept simd_reducible  =   arithmetic_product_type<T>
+                            &&  std::is_integral_v<projection_t<T,F>>
+                            &&  !std::same_as<projection_t<T,F>, bool>
+                            &&  (size<T>::value >= 2)
+                            &&  ((size<T>::value & (size<T>::value - 1)) == 0)
+                            &&  (size<T>::value * sizeof(projection_t<T,F>) <= 64);
+
+    // Tree-shaped horizontal minimum or maximum using whole-vector operations
+    template<bool Max, typename R, std::size_t N>
+    R simd_reduce(array_of<R,N> const& data) noexcept
+    {
+      if constexpr(N == 1) return data.values[0];
+      else
+      {
+        vector_t<R,N/2> lo, hi, r;
+        __builtin_memcpy(&lo, data.values        , sizeof(lo));
+        __builtin_memcpy(&hi, data.values + N/2  , sizeof(hi));
+        if constexpr(Max) r = lo > hi ? lo : hi;
+        else              r = lo < hi ? lo : hi;
+
+        array_of<R,N/2> next = {};
+        __builtin_memcpy(next.values, &r, sizeof(r));
+        return simd_reduce<Max>(next);
+      }
+    }
+#else
+    template<typename T, typename F> concept simd_reducible = false;
+#endif
+  }
+}
+
+#endif
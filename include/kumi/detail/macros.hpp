@@ -0,0 +1,17 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+// Internal macros, defined by each kumi header after its own includes and removed at its end by
+// kumi/detail/undef_macros.hpp. This file is therefore intentionally not include-guarded.
+//==================================================================================================
+#define KUMI_FWD(...) static_cast<decltype(__VA_ARGS__) &&>(__VA_ARGS__)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  define KUMI_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#  define KUMI_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
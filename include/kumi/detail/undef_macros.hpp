@@ -0,0 +1,11 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+// Removes the internal macros defined by kumi/detail/macros.hpp
+//==================================================================================================
+#undef KUMI_FWD
+#undef KUMI_NO_UNIQUE_ADDRESS
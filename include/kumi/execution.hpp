@@ -0,0 +1,231 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_EXECUTION_HPP_INCLUDED
+#define KUMI_EXECUTION_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Execution policy requiring algorithms to run sequentially on the calling thread
+  //================================================================================================
+  struct sequenced_policy {};
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Execution policy allowing algorithms to process each element on a different thread
+  //!
+  //! Elements are dispatched to a pool of worker threads that pick the next pending element as
+  //! soon as they are done with their current one, so that elements with uneven costs are balanced
+  //! across workers. The calling thread takes part in the work.
+  //!
+  //! By default, at most `std::thread::hardware_concurrency()` threads are used. This can be
+  //! lowered by calling kumi::par with the maximum number of threads to use.
+  //================================================================================================
+  struct parallel_policy
+  {
+    /// Maximum number of threads to use or 0 to use all available hardware threads
+    std::size_t concurrency = 0;
+
+    /// Builds a kumi::parallel_policy using at most `n` threads
+    constexpr parallel_policy operator()(std::size_t n) const noexcept { return {n}; }
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Concept specifying a type is a kumi execution policy
+  //================================================================================================
+  template<typename T>
+  concept execution_policy =  std::same_as<std::remove_cvref_t<T>, sequenced_policy>
+                          ||  std::same_as<std::remove_cvref_t<T>, parallel_policy>;
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief kumi::sequenced_policy instance
+  //================================================================================================
+  inline constexpr sequenced_policy seq = {};
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief kumi::parallel_policy instance
+  //================================================================================================
+  inline constexpr parallel_policy  par = {};
+
+  namespace detail
+  {
+    //==============================================================================================
+    // Runs task(index<I>) for all I in [0, N[ on a set of threads pulling indexes from a shared
+    // counter. The first exception thrown by a task is rethrown once all threads are joined.
+    //==============================================================================================
+    template<std::size_t N, typename Task>
+    void parallel_invoke(parallel_policy policy, Task& task)
+    {
+      using call_t = void(*)(Task&);
+      static constexpr auto calls = []<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return std::array<call_t, N>{ +[](Task& tsk) { tsk(index<I>); }... };
+      }(std::make_index_sequence<N>{});
+
+      std::atomic<std::size_t>  next  = 0;
+      std::exception_ptr        error = nullptr;
+      std::mutex                guard;
+
+      auto worker = [&]()
+      {
+        for(std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < N;)
+        {
+          try { calls[i](task); }
+          catch(...)
+          {
+            std::lock_guard lock(guard);
+            if(!error) error = std::current_exception();
+            next.store(N, std::memory_order_relaxed);
+          }
+        }
+      };
+
+      std::size_t hw      = std::thread::hardware_concurrency();
+      std::size_t limit   = policy.concurrency ? policy.concurrency : (hw ? hw : 1);
+      std::size_t helpers = (limit < N ? limit : N) - 1;
+
+      {
+        std::vector<std::jthread> pool;
+        pool.reserve(helpers);
+
+        // If threads can't be spawned, the remaining elements are processed by fewer threads
+        try { while(pool.size() < helpers) pool.emplace_back(worker); }
+        catch(std::system_error const&) {}
+
+        worker();
+      }
+
+      if(error) std::rethrow_exception(error);
+    }
+
+    // Storage for the result of the Ith call of kumi::map, filled by any thread
+    template<std::size_t I, typename Function, typename... Tuples>
+    using map_slot_t = std::optional< std::decay_t< std::invoke_result_t< Function&
+                                                                        , member_t<I,Tuples>...
+                                                                        >
+                                                  >
+                                    >;
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each element of a kumi::product_type using an
+  //!        execution policy.
+  //!
+  //! When called with kumi::par, the invocations of f on each set of elements may run concurrently
+  //! on different threads. f is then required to be safe to invoke concurrently. If any invocation
+  //! of f throws, the first exception caught is rethrown after all running invocations completed
+  //! and elements not yet processed are skipped.
+  //!
+  //! @note This function does not take part in overload resolution if `f` can't be applied to the
+  //!       elements of `t` and/or `ts`.
+  //!
+  //! @param policy Execution policy to use
+  //! @param f      Callable object to be invoked
+  //! @param t      kumi::product_type whose elements to be used as arguments to f
+  //! @param ts     Other kumi::product_type whose elements to be used as arguments to f
+  //!
+  //! @see kumi::for_each
+  //!
+  //! ## Example
+  //! @include doc/for_each_par.cpp
+  //================================================================================================
+  template<execution_policy Policy, typename Function, product_type Tuple, product_type... Tuples>
+  void for_each(Policy policy, Function f, Tuple&& t, Tuples&&... ts)
+  requires detail::applicable<Function, Tuple, Tuples...>
+  {
+    if constexpr( std::same_as<Policy, sequenced_policy> || sized_product_type<Tuple,0> )
+    {
+      kumi::for_each(f, std::forward<Tuple>(t), std::forward<Tuples>(ts)...);
+    }
+    else
+    {
+      auto task = [&]<std::size_t I>(index_t<I>)
+      {
+        f(get<I>(std::forward<Tuple>(t)), get<I>(std::forward<Tuples>(ts))...);
+      };
+
+      detail::parallel_invoke<size<Tuple>::value>(policy, task);
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each element of a kumi::product_type using an
+  //!        execution policy and stores the results in a kumi::tuple.
+  //!
+  //! When called with kumi::par, the invocations of f on each set of elements may run concurrently
+  //! on different threads. f is then required to be safe to invoke concurrently. If any invocation
+  //! of f throws, the first exception caught is rethrown after all running invocations completed.
+  //!
+  //! The result is the same as the one of kumi::map called with the same arguments.
+  //!
+  //! @note Does not participate in overload resolution if tuples' size are not equal or if `f`
+  //!       can't be called on each tuple's elements.
+  //!
+  //! @param policy Execution policy to use
+  //! @param f      Callable function to apply
+  //! @param t0     Tuple  to operate on
+  //! @param others Tuples to operate on
+  //! @return The tuple of `f` calls results.
+  //!
+  //! @see kumi::map
+  //!
+  //! ## Example
+  //! @include doc/map_par.cpp
+  //================================================================================================
+  template< execution_policy Policy, product_type Tuple, typename Function
+          , sized_product_type<size<Tuple>::value>... Tuples
+          >
+  auto map(Policy policy, Function f, Tuple&& t0, Tuples&&... others)
+  requires detail::applicable<Function, Tuple&&, Tuples&&...>
+  {
+    if constexpr( std::same_as<Policy, sequenced_policy> || sized_product_type<Tuple,0> )
+    {
+      return kumi::map(f, std::forward<Tuple>(t0), std::forward<Tuples>(others)...);
+    }
+    else
+    {
+      auto results = [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return kumi::tuple<detail::map_slot_t<I, Function, Tuple&&, Tuples&&...>...>{};
+      }(std::make_index_sequence<size<Tuple>::value>{});
+
+      auto task = [&]<std::size_t I>(index_t<I>)
+      {
+        get<I>(results).emplace ( f ( get<I>(std::forward<Tuple>(t0))
+                                    , get<I>(std::forward<Tuples>(others))...
+                                    )
+                                );
+      };
+
+      detail::parallel_invoke<size<Tuple>::value>(policy, task);
+
+      return kumi::apply( [](auto&... r) { return kumi::make_tuple(std::move(*r)...); }, results );
+    }
+  }
+}
+
+#endif
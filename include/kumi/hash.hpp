@@ -0,0 +1,207 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_HASH_HPP_INCLUDED
+#define KUMI_HASH_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace kumi
+{
+  namespace detail
+  {
+    template<typename T> constexpr bool is_hashable() noexcept
+    {
+      using type = std::remove_cvref_t<T>;
+      if constexpr(product_type<type>)
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return (is_hashable<element_t<I,type>>() && ... && true);
+        }(std::make_index_sequence<size<type>::value>{});
+      }
+      else
+      {
+        return requires(std::hash<type> h, type const& v)
+        {
+          { h(v) } -> std::convertible_to<std::size_t>;
+        };
+      }
+    }
+
+    // Final mixing step of splitmix64
+    constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept
+    {
+      h ^= h >> 30; h *= 0xBF58476D1CE4E5B9ULL;
+      h ^= h >> 27; h *= 0x94D049BB133111EBULL;
+      h ^= h >> 31;
+      return h;
+    }
+
+    constexpr std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t h) noexcept
+    {
+      return hash_mix(seed ^ (h + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2)));
+    }
+
+    // Hash a contiguous block of bytes eight bytes at a time
+    inline std::uint64_t hash_bytes(void const* data, std::size_t n) noexcept
+    {
+      auto const*   ptr = static_cast<unsigned char const*>(data);
+      std::uint64_t h   = hash_mix(n * 0x9E3779B97F4A7C15ULL);
+
+      for(; n >= 8; n -= 8, ptr += 8)
+      {
+        std::uint64_t k;
+        std::memcpy(&k, ptr, 8);
+        h = hash_mix(h ^ k) + 0x9E3779B97F4A7C15ULL;
+      }
+
+      if(n)
+      {
+        std::uint64_t k = 0;
+        std::memcpy(&k, ptr, n);
+        h = hash_mix(h ^ k) + 0x9E3779B97F4A7C15ULL;
+      }
+
+      return hash_mix(h);
+    }
+
+    // Flattened values of a product type
+    template<typename T>
+    using hash_image_t = result::flatten_all_t<T const&>;
+
+    // Product types whose values are fully described by the bytes of their flattened values
+    template<typename T> constexpr bool is_bytewise_hashable() noexcept
+    {
+      using image = hash_image_t<T>;
+      if constexpr(!std::has_unique_object_representations_v<image>) return false;
+      else
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return (( std::is_integral_v<element_t<I,image>>
+                  || std::is_enum_v<element_t<I,image>>
+                  ) && ...
+                 );
+        }(std::make_index_sequence<size<image>::value>{});
+      }
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Concept specifying a type can be hashed by kumi::hash
+  //!
+  //! A type `T` satisfies kumi::hashable if and only if it is a kumi::product_type whose elements
+  //! are, recursively, either kumi::hashable or types for which `std::hash` is enabled.
+  //================================================================================================
+  template<typename T>
+  concept hashable = product_type<T> && detail::is_hashable<T>();
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Computes a hash value for a kumi::product_type
+  //!
+  //! Hash values of each element are computed with `std::hash`, or with kumi::hash for nested
+  //! kumi::product_type, and combined from left to right with kumi::fold_left.
+  //!
+  //! Product types whose flattened values are all integers or enumerations packed without padding
+  //! are instead hashed in a single pass over their bytes.
+  //!
+  //! The hash value only depends on the values of the elements and on the type of the flattened
+  //! values with references and qualifiers removed. Notably, a kumi::tuple and a kumi::tuple of
+  //! references to the same values, as built by kumi::tie, have the same hash value.
+  //!
+  //! @param t kumi::product_type to hash
+  //! @return The hash value of t
+  //!
+  //! ## Example:
+  //! @include doc/hash.cpp
+  //================================================================================================
+  template<hashable T> [[nodiscard]] std::size_t hash(T const& t)
+  {
+    if constexpr(detail::is_bytewise_hashable<T>())
+    {
+      if constexpr(std::same_as<std::remove_cvref_t<T>, detail::hash_image_t<T>>)
+      {
+        return static_cast<std::size_t>(detail::hash_bytes(std::addressof(t), sizeof(t)));
+      }
+      else
+      {
+        auto const image = kumi::flatten_all(t);
+        return static_cast<std::size_t>(detail::hash_bytes(std::addressof(image), sizeof(image)));
+      }
+    }
+    else
+    {
+      auto const seed = detail::hash_mix(size<T>::value);
+      return static_cast<std::size_t>
+      ( kumi::fold_left ( []<typename E>(std::uint64_t h, E const& e)
+                          {
+                            using type = std::remove_cvref_t<E>;
+                            if constexpr(product_type<type>)
+                              return detail::hash_combine(h, kumi::hash(e));
+                            else
+                              return detail::hash_combine(h, std::hash<type>{}(e));
+                          }
+                        , t, seed
+                        )
+      );
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Transparent hash function object for kumi::product_type
+  //!
+  //! Used as the hash function of an unordered container, along with kumi::transparent_equal,
+  //! allows looking up keys using any kumi::product_type with the same hash value, like a
+  //! kumi::tuple of `std::string_view` built with kumi::tie when keys hold `std::string`.
+  //================================================================================================
+  struct transparent_hash
+  {
+    using is_transparent = void;
+
+    template<hashable T> std::size_t operator()(T const& t) const { return kumi::hash(t); }
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Transparent equality function object for kumi::product_type
+  //! @see kumi::transparent_hash
+  //================================================================================================
+  struct transparent_equal
+  {
+    using is_transparent = void;
+
+    template<product_type T, sized_product_type<size<T>::value> U>
+    constexpr bool operator()(T const& a, U const& b) const
+    requires( detail::check_equality<T,U>() )
+    {
+      return kumi::to_ref(a) == kumi::to_ref(b);
+    }
+  };
+}
+
+//==================================================================================================
+// Hashing support for kumi::tuple
+//==================================================================================================
+template<typename... Ts>
+requires( kumi::hashable<kumi::tuple<Ts...>> )
+struct std::hash<kumi::tuple<Ts...>>
+{
+  std::size_t operator()(kumi::tuple<Ts...> const& t) const { return kumi::hash(t); }
+};
+
+#endif
@@ -0,0 +1,49 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_IO_HPP_INCLUDED
+#define KUMI_IO_HPP_INCLUDED
+
+#include <kumi/core.hpp>
+#include <kumi/compact_tuple.hpp>
+#include <kumi/algorithm/for_each.hpp>
+#include <iosfwd>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::tuple
+  //! @brief Inserts a kumi::tuple in an output stream
+  //================================================================================================
+  template<typename CharT, typename Traits, typename... Ts>
+  std::basic_ostream<CharT, Traits> &operator<<( std::basic_ostream<CharT, Traits> &os
+                                               , tuple<Ts...> const &t
+                                               ) noexcept
+  {
+    os << "( ";
+    kumi::for_each([&os](auto const &e) { os << e << " "; }, t);
+    os << ")";
+
+    return os;
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @related kumi::compact_tuple
+  //! @brief Inserts a kumi::compact_tuple in an output stream
+  //================================================================================================
+  template<typename CharT, typename Traits, typename... Ts>
+  std::basic_ostream<CharT, Traits> &operator<<( std::basic_ostream<CharT, Traits> &os
+                                               , compact_tuple<Ts...> const &t
+                                               ) noexcept
+  {
+    return os << kumi::to_ref(t);
+  }
+}
+
+#endif
@@ -0,0 +1,233 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_LOOKUP_HPP_INCLUDED
+#define KUMI_LOOKUP_HPP_INCLUDED
+
+#include <kumi/record.hpp>
+#include <kumi/tuple.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace kumi
+{
+  namespace detail
+  {
+    // FNV-1a, with the seed mixed in the initial state. The final avalanche step makes the low
+    // bits, which are the only ones used when reducing modulo a power of two, depend on all the
+    // bits of the state.
+    constexpr std::uint64_t name_hash(std::uint64_t seed, std::string_view s) noexcept
+    {
+      std::uint64_t h = 0xCBF29CE484222325ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+      for(char c : s)
+      {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001B3ULL;
+      }
+
+      h ^= h >> 33; h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53ULL;
+      return h ^ (h >> 33);
+    }
+
+    // Minimal perfect hash built with the hash-and-displace method: keys are first spread in N
+    // buckets, then each bucket, starting from the largest, receives a seed mapping all its keys
+    // to free slots. Buckets of a single key directly store their slot.
+    template<std::size_t N> struct perfect_hash
+    {
+      // size is at least 1 so MSVC don't cry when we use a 0-sized array
+      std::int64_t      displacement[N+1] = {};
+      std::size_t       index[N+1]        = {};
+      std::string_view  keys[N+1]         = {};
+
+      constexpr perfect_hash(std::string_view const (&names)[N+1]) noexcept
+      {
+        std::size_t bucket_of[N+1] = {}, bucket_size[N+1] = {}, order[N+1] = {};
+        bool        used[N+1]      = {};
+
+        for(std::size_t k=0;k<N;++k)
+        {
+          bucket_of[k] = name_hash(0, names[k]) % N;
+          bucket_size[bucket_of[k]]++;
+        }
+
+        // Process buckets by decreasing size
+        for(std::size_t b=0;b<N;++b) order[b] = b;
+        for(std::size_t i=1;i<N;++i)
+          for(std::size_t j=i;j>0 && bucket_size[order[j-1]] < bucket_size[order[j]];--j)
+            std::swap(order[j-1], order[j]);
+
+        std::size_t free_slot = 0;
+        for(std::size_t o=0;o<N;++o)
+        {
+          auto const b = order[o];
+          if(bucket_size[b] == 0) break;
+
+          if(bucket_size[b] == 1)
+          {
+            while(used[free_slot]) ++free_slot;
+            for(std::size_t k=0;k<N;++k)
+              if(bucket_of[k] == b) place(k, free_slot, names, used);
+            displacement[b] = -static_cast<std::int64_t>(free_slot) - 1;
+            continue;
+          }
+
+          for(std::uint64_t seed = 1;;++seed)
+          {
+            std::size_t slots[N+1] = {}, count = 0;
+            bool        fits       = true;
+
+            for(std::size_t k=0;k<N && fits;++k)
+            {
+              if(bucket_of[k] != b) continue;
+              auto const s = name_hash(seed, names[k]) % N;
+              fits = !used[s];
+              for(std::size_t i=0;i<count && fits;++i) fits = slots[i] != s;
+              slots[count++] = s;
+            }
+
+            if(fits)
+            {
+              for(std::size_t k=0, i=0;k<N;++k)
+                if(bucket_of[k] == b) place(k, slots[i++], names, used);
+              displacement[b] = static_cast<std::int64_t>(seed);
+              break;
+            }
+          }
+        }
+      }
+
+      constexpr void place( std::size_t k, std::size_t slot
+                          , std::string_view const (&names)[N+1], bool (&used)[N+1]
+                          ) noexcept
+      {
+        used[slot]  = true;
+        index[slot] = k;
+        keys[slot]  = names[k];
+      }
+
+      constexpr std::size_t find(std::string_view name) const noexcept
+      {
+        if constexpr(N == 0) return 0;
+        else
+        {
+          auto const d    = displacement[name_hash(0, name) % N];
+          auto const slot = d < 0 ? static_cast<std::size_t>(-d - 1)
+                                  : static_cast<std::size_t>(name_hash(d, name) % N);
+          return keys[slot] == name ? index[slot] : N;
+        }
+      }
+    };
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Constant-time runtime lookup of a name among a compile-time list of names
+  //!
+  //! kumi::name_index builds, at compile time, a minimal perfect hash of its names. Looking up a
+  //! runtime string then costs two hash computations and one string comparison, whatever the
+  //! number of names, and never allocates.
+  //!
+  //! @tparam Names Unique names to look up, usually the names of the elements of a
+  //!               kumi::product_type.
+  //!
+  //! ## Example:
+  //! @include doc/visit_field.cpp
+  //================================================================================================
+  template<field_name... Names> struct name_index
+  {
+    static_assert ( detail::record_names<field<Names,void>...>::unique()
+                  , "[KUMI] - kumi::name_index names must be unique"
+                  );
+
+    /// Number of names
+    static constexpr std::size_t size = sizeof...(Names);
+
+    //==============================================================================================
+    //! @brief Finds the position of a name
+    //! @param  name Name to look for
+    //! @return The position of name in `Names...` if present, `sizeof...(Names)` otherwise.
+    //==============================================================================================
+    [[nodiscard]] static constexpr std::size_t find(std::string_view name) noexcept
+    {
+      return table.find(name);
+    }
+
+    private:
+    static constexpr std::string_view names[sizeof...(Names)+1] = { Names.view()..., {} };
+    static constexpr detail::perfect_hash<sizeof...(Names)> table{names};
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief kumi::name_index of the field names of a kumi::record
+  //================================================================================================
+  template<typename Record> struct record_index;
+
+  template<typename... Fs> struct record_index<record<Fs...>>
+  {
+    using type = name_index<Fs::name...>;
+  };
+
+  template<typename Record>
+  using record_index_t = typename record_index<std::remove_cvref_t<Record>>::type;
+
+  //================================================================================================
+  //! @ingroup queries
+  //! @brief  Invokes f on the element of a kumi::product_type designated by a runtime name.
+  //!
+  //! The name is converted to an index through kumi::name_index then the element is accessed
+  //! through kumi::visit_at, both in constant time.
+  //!
+  //! @tparam Names Names of each element of t, in order
+  //! @param  t     kumi::product_type to access
+  //! @param  name  Runtime name of the element to access
+  //! @param  f     Callable object invoked on the selected element
+  //! @return `true` if an element named name exists and f was called on it, `false` otherwise.
+  //!
+  //! ## Example:
+  //! @include doc/visit_field.cpp
+  //================================================================================================
+  template<field_name... Names, product_type Tuple, typename Function>
+  requires(sizeof...(Names) == size<Tuple>::value && sizeof...(Names) > 0)
+  constexpr bool visit_field(Tuple&& t, std::string_view name, Function&& f)
+  {
+    auto const i = name_index<Names...>::find(name);
+    if(i == sizeof...(Names)) return false;
+
+    kumi::visit_at(std::forward<Tuple>(t), i, [&](auto&& e) { f(std::forward<decltype(e)>(e)); });
+    return true;
+  }
+
+  //================================================================================================
+  //! @ingroup queries
+  //! @brief  Invokes f on the field of a kumi::record designated by a runtime name.
+  //!
+  //! @param  r     kumi::record to access
+  //! @param  name  Runtime name of the field to access
+  //! @param  f     Callable object invoked on the selected field
+  //! @return `true` if a field named name exists and f was called on it, `false` otherwise.
+  //!
+  //! ## Example:
+  //! @include doc/visit_field.cpp
+  //================================================================================================
+  template<typename Record, typename Function>
+  requires requires { typename record_index_t<Record>; } && (size<Record>::value > 0)
+  constexpr bool visit_field(Record&& r, std::string_view name, Function&& f)
+  {
+    auto const i = record_index_t<Record>::find(name);
+    if(i == size<Record>::value) return false;
+
+    kumi::visit_at(std::forward<Record>(r), i, [&](auto&& e) { f(std::forward<decltype(e)>(e)); });
+    return true;
+  }
+}
+
+#endif
@@ -0,0 +1,392 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_RECORD_HPP_INCLUDED
+#define KUMI_RECORD_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Compile-time string used to name the fields of a kumi::record
+  //!
+  //! kumi::field_name is a structural type so that string literals can be passed as template
+  //! parameters, as in `kumi::field<"price", double>` or `get<"price">(r)`.
+  //================================================================================================
+  template<std::size_t N> struct field_name
+  {
+    /// Characters of the name, including the terminating null character
+    char value[N];
+
+    /// Builds a kumi::field_name from a string literal
+    constexpr field_name(char const (&s)[N]) noexcept
+    {
+      for(std::size_t i=0;i<N;++i) value[i] = s[i];
+    }
+
+    /// Returns the name as a `std::string_view`
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {value, N-1}; }
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Compile-time label of a kumi::record field
+  //!
+  //! Defines a constant wrapper used to access the fields of a kumi::record by name, in the same
+  //! way kumi::index_t is used to access elements by index.
+  //================================================================================================
+  template<field_name Name> struct name_t
+  {
+    /// Name of the field
+    static constexpr auto value = Name;
+  };
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Inline compile-time label value for kumi::name_t
+  //================================================================================================
+  template<field_name Name> inline constexpr name_t<Name> const name = {};
+
+  namespace literals
+  {
+    //==============================================================================================
+    //! @ingroup utility
+    //! @brief Forms a compile-time field label literal.
+    //! @return An instance of kumi::name_t for the specified string
+    //! ## Example:
+    //! @include doc/record.cpp
+    //==============================================================================================
+    template<field_name Name> constexpr auto operator"" _f() noexcept { return name<Name>; }
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Declares a named field of a kumi::record
+  //! @tparam Name  Name of the field
+  //! @tparam T     Type of the field
+  //================================================================================================
+  template<field_name Name, typename T> struct field
+  {
+    static constexpr auto name = Name;
+    using type = T;
+  };
+
+  namespace detail
+  {
+    template<typename... Fields> struct record_names
+    {
+      static constexpr std::string_view all[sizeof...(Fields)+1] = { Fields::name.view()..., {} };
+
+      static constexpr std::size_t find(std::string_view n) noexcept
+      {
+        std::size_t i = 0;
+        while(i < sizeof...(Fields) && all[i] != n) ++i;
+        return i;
+      }
+
+      static constexpr bool unique() noexcept
+      {
+        for(std::size_t i=0;i<sizeof...(Fields);++i)
+          if(find(all[i]) != i) return false;
+        return true;
+      }
+    };
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @class record
+  //! @brief Fixed-size collection of heterogeneous values accessed by name.
+  //!
+  //! kumi::record stores its elements in a kumi::tuple and maps each field name to its index at
+  //! compile time, so that accessing a field by name costs exactly the same as accessing the
+  //! underlying kumi::tuple element by index. kumi::record is a kumi::product_type and can be
+  //! passed to any algorithm or used in structured bindings, elements being ordered as their
+  //! fields are declared.
+  //!
+  //! Like kumi::tuple, kumi::record is an aggregate whose elements are initialized in declaration
+  //! order.
+  //!
+  //! @tparam Fields Sequence of kumi::field declaring the name and type of each element.
+  //!
+  //! ## Example:
+  //! @include doc/record.cpp
+  //================================================================================================
+  template<typename... Fields> struct record
+  {
+    static_assert ( detail::record_names<Fields...>::unique()
+                  , "[KUMI] - kumi::record field names must be unique"
+                  );
+
+    using is_product_type = void;
+    using storage_type    = kumi::tuple<typename Fields::type...>;
+    storage_type impl;
+
+    //==============================================================================================
+    //! @brief Index of the field named Name or `sizeof...(Fields)` if no such field exists
+    //==============================================================================================
+    template<field_name Name>
+    static constexpr std::size_t index_of = detail::record_names<Fields...>::find(Name.view());
+
+    //==============================================================================================
+    //! @brief `true` if the kumi::record contains a field named Name
+    //==============================================================================================
+    template<field_name Name>
+    static constexpr bool contains = index_of<Name> < sizeof...(Fields);
+
+    //==============================================================================================
+    //! @name Accessors
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Extracts the Ith element from a kumi::record
+    //!
+    //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Fields)).
+    //! @param  i Compile-time index of the element to access
+    //! @return A reference to the selected element of current record.
+    //==============================================================================================
+    template<std::size_t I>
+    requires(I < sizeof...(Fields)) constexpr decltype(auto) operator[](index_t<I>) &noexcept
+    {
+      return impl[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Fields)) constexpr decltype(auto) operator[](index_t<I>) &&noexcept
+    {
+      return static_cast<storage_type &&>(impl)[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Fields)) constexpr decltype(auto) operator[](index_t<I>) const &&noexcept
+    {
+      return static_cast<storage_type const &&>(impl)[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Fields)) constexpr decltype(auto) operator[](index_t<I>) const &noexcept
+    {
+      return impl[index<I>];
+    }
+
+    //==============================================================================================
+    //! @brief Extracts the element named Name from a kumi::record
+    //!
+    //! @note Does not participate in overload resolution if no field is named `Name`.
+    //! @param  n Compile-time label of the element to access
+    //! @return A reference to the selected element of current record.
+    //==============================================================================================
+    template<field_name Name>
+    requires(contains<Name>) constexpr decltype(auto) operator[](name_t<Name>) &noexcept
+    {
+      return impl[index<index_of<Name>>];
+    }
+
+    /// @overload
+    template<field_name Name>
+    requires(contains<Name>) constexpr decltype(auto) operator[](name_t<Name>) &&noexcept
+    {
+      return static_cast<storage_type &&>(impl)[index<index_of<Name>>];
+    }
+
+    /// @overload
+    template<field_name Name>
+    requires(contains<Name>) constexpr decltype(auto) operator[](name_t<Name>) const &&noexcept
+    {
+      return static_cast<storage_type const &&>(impl)[index<index_of<Name>>];
+    }
+
+    /// @overload
+    template<field_name Name>
+    requires(contains<Name>) constexpr decltype(auto) operator[](name_t<Name>) const &noexcept
+    {
+      return impl[index<index_of<Name>>];
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Properties
+    //! @{
+    //==============================================================================================
+    /// Returns the number of elements in a kumi::record
+    [[nodiscard]] static constexpr auto size() noexcept { return sizeof...(Fields); }
+
+    /// Returns `true` if a kumi::record contains 0 elements
+    [[nodiscard]] static constexpr bool empty() noexcept { return sizeof...(Fields) == 0; }
+
+    /// Returns a kumi::tuple containing the name of each field as a `std::string_view`
+    [[nodiscard]] static constexpr auto names() noexcept
+    {
+      return kumi::tuple{ Fields::name.view()... };
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Comparison operators
+    //! @{
+    //==============================================================================================
+
+    /// @ingroup tuple
+    /// @related kumi::record
+    /// @brief Compares a kumi::record with an other kumi::product_type for equality
+    template<sized_product_type<sizeof...(Fields)> Other>
+    friend constexpr auto operator==(record const &self, Other const &other) noexcept
+    requires( detail::check_equality<storage_type,Other>() )
+    {
+      return self.impl == other;
+    }
+
+    /// @ingroup tuple
+    /// @related kumi::record
+    /// @brief Performs a lexicographical three-way comparison in declaration order
+    template<sized_product_type<sizeof...(Fields)> Other>
+    friend constexpr auto operator<=>(record const &lhs, Other const &rhs) noexcept
+    requires( detail::check_ordering<storage_type,Other>() )
+    {
+      return lhs.impl <=> rhs;
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    /// @ingroup tuple
+    //! @related kumi::record
+    //! @brief Inserts a kumi::record in an output stream
+    //==============================================================================================
+    template<typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                         record const &r) noexcept
+    {
+      os << "( ";
+      ((os << Fields::name.view() << ": " << r[name<Fields::name>] << " "), ...);
+      os << ")";
+
+      return os;
+    }
+  };
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Extracts the Ith element from a kumi::record
+  //!
+  //! @note Does not participate in overload resolution if `I` is not in [0, sizeof...(Fs)).
+  //! @tparam   I Compile-time index of the element to access
+  //! @param    r kumi::record to access
+  //! @return   A reference to the selected element of r.
+  //! @related kumi::record
+  //================================================================================================
+  template<std::size_t I, typename... Fs>
+  requires(I < sizeof...(Fs)) [[nodiscard]] constexpr decltype(auto) get(record<Fs...> &r) noexcept
+  {
+    return r[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Fs>
+  requires(I < sizeof...(Fs)) [[nodiscard]] constexpr decltype(auto) get(record<Fs...> &&r) noexcept
+  {
+    return static_cast<record<Fs...> &&>(r)[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Fs>
+  requires(I < sizeof...(Fs)) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> const &r) noexcept
+  {
+    return r[index<I>];
+  }
+
+  /// @overload
+  template<std::size_t I, typename... Fs>
+  requires(I < sizeof...(Fs)) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> const &&r) noexcept
+  {
+    return static_cast<record<Fs...> const &&>(r)[index<I>];
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Extracts the element named Name from a kumi::record
+  //!
+  //! @note Does not participate in overload resolution if no field of r is named `Name`.
+  //! @tparam   Name Compile-time name of the element to access
+  //! @param    r    kumi::record to access
+  //! @return   A reference to the selected element of r.
+  //! @related kumi::record
+  //================================================================================================
+  template<field_name Name, typename... Fs>
+  requires(record<Fs...>::template contains<Name>) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> &r) noexcept
+  {
+    return r[name<Name>];
+  }
+
+  /// @overload
+  template<field_name Name, typename... Fs>
+  requires(record<Fs...>::template contains<Name>) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> &&r) noexcept
+  {
+    return static_cast<record<Fs...> &&>(r)[name<Name>];
+  }
+
+  /// @overload
+  template<field_name Name, typename... Fs>
+  requires(record<Fs...>::template contains<Name>) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> const &r) noexcept
+  {
+    return r[name<Name>];
+  }
+
+  /// @overload
+  template<field_name Name, typename... Fs>
+  requires(record<Fs...>::template contains<Name>) [[nodiscard]] constexpr decltype(auto)
+  get(record<Fs...> const &&r) noexcept
+  {
+    return static_cast<record<Fs...> const &&>(r)[name<Name>];
+  }
+}
+
+//==================================================================================================
+// Structured binding adaptation
+//==================================================================================================
+template<typename... Fs>
+struct  std::tuple_size<kumi::record<Fs...>>
+      : std::integral_constant<std::size_t, sizeof...(Fs)>
+{};
+
+template<std::size_t I, typename... Fs>
+struct std::tuple_element<I, kumi::record<Fs...>>
+{
+  using type = std::tuple_element_t<I, kumi::tuple<typename Fs::type...>>;
+};
+
+template<std::size_t I, typename... Fs>
+struct std::tuple_element<I, kumi::record<Fs...> const>
+{
+  using type = std::tuple_element_t<I, kumi::tuple<typename Fs::type...>> const;
+};
+
+#endif
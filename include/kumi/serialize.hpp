@@ -0,0 +1,428 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_SERIALIZE_HPP_INCLUDED
+#define KUMI_SERIALIZE_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup traits
+  //! @brief Opt-in traits for types serialized as their object representation
+  //!
+  //! Arithmetic types, enumerations and arrays of those are serialized as their object
+  //! representation. Other trivially copyable types can opt-in to this behavior by specializing
+  //! `kumi::is_bitwise_serializable` so it exposes a static constant member `value` that evaluates
+  //! to `true`. Such types must not hold pointers, references or handles to other objects, nor
+  //! members for which some bit patterns are invalid, like `bool`, as their content is not
+  //! validated by kumi::deserialize.
+  //================================================================================================
+  template<typename T> struct is_bitwise_serializable : std::false_type {};
+
+  namespace detail
+  {
+    template<typename T>
+    concept raw_scalar  =   (std::is_arithmetic_v<T> || std::is_enum_v<T>) && !std::is_const_v<T>;
+
+    // Values that can be stored as their object representation
+    template<typename T>
+    concept raw_value =     !std::is_unbounded_array_v<T>
+                        &&  (   raw_scalar<std::remove_all_extents_t<T>>
+                            ||  (is_bitwise_serializable<T>::value && std::is_trivially_copyable_v<T>)
+                            );
+
+    // Values whose object representation has to be validated when read
+    template<typename T>
+    concept checked_value = std::same_as<std::remove_all_extents_t<T>, bool>;
+
+    // Resizable contiguous sequences of raw values, stored as their size followed by their data
+    template<typename T>
+    concept raw_sequence  =   std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+                          &&  raw_value<std::ranges::range_value_t<T>>
+                          &&  requires(T& s, std::size_t n) { s.resize(n); };
+
+    template<typename T> constexpr bool is_serializable() noexcept
+    {
+      if constexpr(std::is_reference_v<T> || std::is_const_v<T>) return false;
+      else if constexpr(product_type<T>)
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return (is_serializable<element_t<I,T>>() && ... && true);
+        }(std::make_index_sequence<size<T>::value>{});
+      }
+      else return raw_value<T> || raw_sequence<T>;
+    }
+
+    template<typename T> constexpr bool has_checked_value() noexcept
+    {
+      if constexpr(product_type<T>)
+      {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return (has_checked_value<element_t<I,T>>() || ... || false);
+        }(std::make_index_sequence<size<T>::value>{});
+      }
+      else return checked_value<T>;
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Concept specifying a type can be processed by kumi::serialize and kumi::deserialize
+  //!
+  //! A type `T` satisfies kumi::serializable if and only if it is a default constructible
+  //! kumi::product_type whose elements are, recursively, either:
+  //!   - a serializable kumi::product_type,
+  //!   - an arithmetic type, an enumeration, an array of those or a type for which
+  //!     kumi::is_bitwise_serializable is `true`,
+  //!   - a resizable contiguous range of such types like `std::string` or `std::vector<float>`.
+  //!
+  //! Types like `std::string_view` or `std::span` that refer to other objects are not
+  //! serializable.
+  //!
+  //! Elements can't be references or `const` qualified.
+  //================================================================================================
+  template<typename T>
+  concept serializable  =   product_type<T> && std::default_initializable<T>
+                        &&  detail::is_serializable<T>();
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Version of the binary layout used by kumi::serialize
+  //!
+  //! This value is stored in every serialized buffer and is increased each time the binary layout
+  //! changes. kumi::deserialize rejects buffers produced with a different version.
+  //================================================================================================
+  inline constexpr std::uint16_t serialization_version = 2;
+
+  namespace detail
+  {
+    // Types whose object representation can be copied as a whole
+    template<typename T>
+    concept raw_serializable  =   serializable<T> && std::is_trivially_copyable_v<T>
+                              &&  !has_checked_value<T>();
+
+    // FNV-1a hash of the description of the serialized layout
+    struct layout_hash
+    {
+      std::uint64_t value = 14695981039346656037ULL;
+
+      constexpr void add(std::uint64_t v) noexcept
+      {
+        for(int i=0;i<8;++i)
+        {
+          value ^= (v >> (8*i)) & 0xFF;
+          value *= 1099511628211ULL;
+        }
+      }
+    };
+
+    template<typename T> constexpr void describe(layout_hash& h) noexcept
+    {
+      if constexpr(product_type<T>)
+      {
+        h.add(0x10);
+        h.add(size<T>::value);
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+          (describe<element_t<I,T>>(h),...);
+        }(std::make_index_sequence<size<T>::value>{});
+        h.add(0x11);
+      }
+      else if constexpr(raw_sequence<T>)
+      {
+        h.add(0x20);
+        describe<std::ranges::range_value_t<T>>(h);
+      }
+      else if constexpr(std::is_array_v<T>)
+      {
+        h.add(0x30);
+        h.add(std::extent_v<T>);
+        describe<std::remove_extent_t<T>>(h);
+      }
+      else
+      {
+        if constexpr(std::same_as<T,bool>)            h.add(0x01);
+        else if constexpr(std::is_floating_point_v<T>)  h.add(0x02);
+        else if constexpr(std::is_signed_v<T>)          h.add(0x03);
+        else if constexpr(std::is_unsigned_v<T>)        h.add(0x04);
+        else if constexpr(std::is_enum_v<T>)            h.add(0x05);
+        else                                            h.add(0x06);
+        h.add(sizeof(T));
+        h.add(alignof(T));
+      }
+    }
+
+    template<typename T> constexpr std::uint64_t layout_of() noexcept
+    {
+      layout_hash h;
+      describe<T>(h);
+      if constexpr(raw_serializable<T>) h.add(sizeof(T));
+      return h.value;
+    }
+
+    // Fixed size header stored in front of every serialized buffer
+    struct serial_header
+    {
+      static constexpr std::uint32_t  magic     = 0x494D554B; // "KUMI"
+      static constexpr std::size_t    size      = 24;
+      static constexpr std::uint16_t  big_endian = 1;
+      static constexpr std::uint16_t  raw_image  = 2;
+
+      std::uint32_t tag     = magic;
+      std::uint16_t version = serialization_version;
+      std::uint16_t flags   = 0;
+      std::uint64_t layout  = 0;
+      std::uint64_t payload = 0;
+
+      template<typename T> static constexpr std::uint16_t flags_of() noexcept
+      {
+        return  (std::endian::native == std::endian::big ? big_endian : 0)
+              | (raw_serializable<T> ? raw_image : 0);
+      }
+    };
+
+    struct byte_writer
+    {
+      std::byte* ptr;
+
+      void write(void const* src, std::size_t n) noexcept
+      {
+        if(n) std::memcpy(ptr, src, n);
+        ptr += n;
+      }
+
+      template<typename T> void operator()(T const& v) noexcept
+      {
+        if constexpr(raw_sequence<T>)
+        {
+          std::uint64_t n = std::ranges::size(v);
+          write(&n, sizeof(n));
+          write(std::ranges::data(v), n * sizeof(std::ranges::range_value_t<T>));
+        }
+        else write(&v, sizeof(T));
+      }
+    };
+
+    struct byte_reader
+    {
+      std::byte const*  ptr;
+      std::size_t       left;
+      bool              valid = true;
+
+      bool read(void* dst, std::size_t n) noexcept
+      {
+        if(!valid || n > left) return valid = false;
+        if(n) std::memcpy(dst, ptr, n);
+        ptr += n;
+        left -= n;
+        return true;
+      }
+
+      // Reads values whose object representation may be invalid, rejecting invalid bytes
+      template<typename T> void check(T& v) noexcept
+      {
+        if constexpr(std::is_array_v<T>)
+        {
+          for(auto& e : v) check(e);
+        }
+        else
+        {
+          unsigned char b = 0;
+          if(read(&b, sizeof(b)) && b > 1) valid = false;
+          v = (b == 1);
+        }
+      }
+
+      template<typename T> void operator()(T& v)
+      {
+        if constexpr(raw_sequence<T>)
+        {
+          using value_t = std::ranges::range_value_t<T>;
+          std::uint64_t n = 0;
+          if(!read(&n, sizeof(n)) || n > left / sizeof(value_t)) { valid = false; return; }
+          v.resize(static_cast<std::size_t>(n));
+
+          if constexpr(checked_value<value_t>) for(auto& e : v) check(e);
+          else read(std::ranges::data(v), static_cast<std::size_t>(n) * sizeof(value_t));
+        }
+        else if constexpr(checked_value<T>) check(v);
+        else read(&v, sizeof(T));
+      }
+    };
+
+    template<typename T, typename Function> constexpr void for_each_leaf(T&& t, Function& f)
+    {
+      if constexpr(product_type<T>)
+        kumi::for_each([&](auto&& m) { for_each_leaf(std::forward<decltype(m)>(m), f); }, t);
+      else
+        f(t);
+    }
+
+    struct byte_counter
+    {
+      std::size_t count = 0;
+
+      template<typename T> constexpr void operator()(T const& v) noexcept
+      {
+        if constexpr(raw_sequence<T>)
+        {
+          count += sizeof(std::uint64_t);
+          count += std::ranges::size(v) * sizeof(std::ranges::range_value_t<T>);
+        }
+        else count += sizeof(T);
+      }
+    };
+
+    template<typename T> constexpr std::size_t payload_size(T const& t) noexcept
+    {
+      if constexpr(raw_serializable<T>) return sizeof(T);
+      else
+      {
+        byte_counter counter;
+        for_each_leaf(t, counter);
+        return counter.count;
+      }
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Computes the number of bytes required to serialize a value
+  //! @param t kumi::serializable value to inspect
+  //! @return The size in bytes of the buffer filled by kumi::serialize(t)
+  //================================================================================================
+  template<serializable T>
+  [[nodiscard]] constexpr std::size_t serialized_size(T const& t) noexcept
+  {
+    return detail::serial_header::size + detail::payload_size(t);
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Writes the binary representation of a value into a buffer
+  //!
+  //! The serialized data starts with a header containing kumi::serialization_version and a
+  //! fingerprint of the type layout, followed by all the elements of `t` taken in the order of
+  //! kumi::flatten_all. Trivially copyable values are written with a single `memcpy`. Other
+  //! values have each of their element written without padding and each of their ranges written
+  //! as its size followed by its contents.
+  //!
+  //! Values are written in the platform's byte order, which is recorded in the header.
+  //!
+  //! @param t      kumi::serializable value to serialize
+  //! @param buffer Contiguous bytes storage to write to
+  //! @return The part of `buffer` that has been written to, or an empty span if `buffer` is not
+  //!         large enough to hold kumi::serialized_size(t) bytes.
+  //!
+  //! ## Example:
+  //! @include doc/serialize.cpp
+  //================================================================================================
+  template<serializable T>
+  std::span<std::byte> serialize(T const& t, std::span<std::byte> buffer) noexcept
+  {
+    auto const payload  = detail::payload_size(t);
+    auto const total    = detail::serial_header::size + payload;
+    if(buffer.size() < total) return {};
+
+    detail::serial_header head;
+    head.flags    = detail::serial_header::flags_of<T>();
+    head.layout   = detail::layout_of<T>();
+    head.payload  = payload;
+
+    detail::byte_writer out{buffer.data()};
+    out(head.tag);
+    out(head.version);
+    out(head.flags);
+    out(head.layout);
+    out(head.payload);
+
+    if constexpr(detail::raw_serializable<T>) out.write(std::addressof(t), sizeof(T));
+    else                                      detail::for_each_leaf(t, out);
+
+    return buffer.first(total);
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Builds the binary representation of a value
+  //! @param t kumi::serializable value to serialize
+  //! @return A `std::vector` containing the bytes written by kumi::serialize(t, buffer)
+  //================================================================================================
+  template<serializable T> [[nodiscard]] std::vector<std::byte> serialize(T const& t)
+  {
+    std::vector<std::byte> bytes(serialized_size(t));
+    kumi::serialize(t, std::span<std::byte>(bytes));
+    return bytes;
+  }
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Rebuilds a value from its binary representation
+  //!
+  //! The buffer is rejected if it was not produced by kumi::serialize for the same type, with
+  //! the same kumi::serialization_version and on a platform with the same byte order, if it is
+  //! truncated or if it contains a `bool` whose value is neither `0` nor `1`.
+  //!
+  //! @tparam T     kumi::serializable type to rebuild
+  //! @param  bytes Bytes produced by kumi::serialize
+  //! @return The deserialized value or `std::nullopt` if `bytes` does not start with a valid
+  //!         representation of a value of type `T`.
+  //!
+  //! ## Example:
+  //! @include doc/serialize.cpp
+  //================================================================================================
+  template<serializable T>
+  [[nodiscard]] std::optional<T> deserialize(std::span<std::byte const> bytes)
+  {
+    detail::byte_reader   in{bytes.data(), bytes.size()};
+    detail::serial_header head;
+    in(head.tag);
+    in(head.version);
+    in(head.flags);
+    in(head.layout);
+    in(head.payload);
+
+    if(   !in.valid
+      ||  head.tag      != detail::serial_header::magic
+      ||  head.version  != serialization_version
+      ||  head.flags    != detail::serial_header::flags_of<T>()
+      ||  head.layout   != detail::layout_of<T>()
+      ||  head.payload  >  in.left
+      )
+    {
+      return std::nullopt;
+    }
+
+    // Bytes past the payload are not part of the serialized value
+    in.left = static_cast<std::size_t>(head.payload);
+
+    std::optional<T> result(std::in_place);
+    if constexpr(detail::raw_serializable<T>) in.read(std::addressof(*result), sizeof(T));
+    else                                      detail::for_each_leaf(*result, in);
+
+    if(!in.valid || in.left != 0) return std::nullopt;
+    return result;
+  }
+}
+
+#endif
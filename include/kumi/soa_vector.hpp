@@ -0,0 +1,453 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_SOA_VECTOR_HPP_INCLUDED
+#define KUMI_SOA_VECTOR_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace kumi
+{
+  //================================================================================================
+  //! @ingroup tuple
+  //! @class soa_vector
+  //! @brief Dynamic sequence of kumi::tuple stored as a structure of arrays.
+  //!
+  //! kumi::soa_vector stores each element type in its own contiguous buffer aligned on
+  //! kumi::soa_vector::alignment bytes. Indexing a kumi::soa_vector returns a kumi::tuple of
+  //! references to the elements of each column, while kumi::soa_vector::columns gives access to
+  //! all columns as a kumi::tuple of `std::span` suitable for column-wise algorithms.
+  //!
+  //! @tparam Ts Sequence of types stored in each row of kumi::soa_vector.
+  //!
+  //! ## Example:
+  //! @include doc/soa_vector.cpp
+  //================================================================================================
+  template<typename... Ts> class soa_vector
+  {
+    template<bool Const> class iterator_t;
+
+    public:
+    using value_type      = kumi::tuple<Ts...>;
+    using reference       = kumi::tuple<Ts&...>;
+    using const_reference = kumi::tuple<Ts const&...>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator        = iterator_t<false>;
+    using const_iterator  = iterator_t<true>;
+
+    /// Minimal alignment in bytes of each column
+    static constexpr std::size_t alignment = 64;
+
+    //==============================================================================================
+    //! @name Constructors
+    //! @{
+    //==============================================================================================
+
+    /// Constructs an empty kumi::soa_vector
+    soa_vector() noexcept = default;
+
+    /// Constructs a kumi::soa_vector containing `n` value-initialized rows
+    explicit soa_vector(size_type n) { resize(n); }
+
+    /// Copy constructor
+    soa_vector(soa_vector const& other) : soa_vector()
+    {
+      reserve(other.size_);
+      for(size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+    }
+
+    /// Move constructor
+    soa_vector(soa_vector&& other) noexcept
+              : data_(std::exchange(other.data_, {}))
+              , size_(std::exchange(other.size_, 0))
+              , capacity_(std::exchange(other.capacity_, 0))
+    {}
+
+    /// Copy and move assignment operator
+    soa_vector& operator=(soa_vector other) noexcept
+    {
+      swap(other);
+      return *this;
+    }
+
+    ~soa_vector()
+    {
+      clear();
+      release(data_);
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Accessors
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Access the ith row of a kumi::soa_vector
+    //! @param i Index of the row to access
+    //! @return A kumi::tuple of references to each element of the row
+    //==============================================================================================
+    reference operator[](size_type i) noexcept
+    {
+      return kumi::apply([i](auto*... cols) { return reference{cols[i]...}; }, data_);
+    }
+
+    /// @overload
+    const_reference operator[](size_type i) const noexcept
+    {
+      return kumi::apply([i](auto*... cols) { return const_reference{cols[i]...}; }, data_);
+    }
+
+    //==============================================================================================
+    //! @brief Access the Ith column of a kumi::soa_vector
+    //! @tparam I Index of the column to access
+    //! @return A `std::span` over all the elements of the column
+    //==============================================================================================
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) [[nodiscard]] auto column() noexcept
+    {
+      return std::span<element_t<I, value_type>>(get<I>(data_), size_);
+    }
+
+    /// @overload
+    template<std::size_t I>
+    requires(I < sizeof...(Ts)) [[nodiscard]] auto column() const noexcept
+    {
+      return std::span<element_t<I, value_type> const>(get<I>(data_), size_);
+    }
+
+    //==============================================================================================
+    //! @brief Access all the columns of a kumi::soa_vector
+    //! @return A kumi::tuple containing a `std::span` over each column
+    //==============================================================================================
+    [[nodiscard]] auto columns() noexcept
+    {
+      return kumi::apply( [n = size_](auto*... cols)
+                          {
+                            return kumi::make_tuple(std::span(cols, n)...);
+                          }
+                        , data_
+                        );
+    }
+
+    /// @overload
+    [[nodiscard]] auto columns() const noexcept
+    {
+      return kumi::apply( [n = size_](auto const*... cols)
+                          {
+                            return kumi::make_tuple(std::span(cols, n)...);
+                          }
+                        , data_
+                        );
+    }
+
+    iterator       begin()        noexcept { return {this, 0};      }
+    iterator       end()          noexcept { return {this, size_};  }
+    const_iterator begin()  const noexcept { return {this, 0};      }
+    const_iterator end()    const noexcept { return {this, size_};  }
+    const_iterator cbegin() const noexcept { return {this, 0};      }
+    const_iterator cend()   const noexcept { return {this, size_};  }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Properties
+    //! @{
+    //==============================================================================================
+
+    /// Returns the number of rows in a kumi::soa_vector
+    [[nodiscard]] size_type size()      const noexcept { return size_;      }
+
+    /// Returns the number of rows that can be held without reallocation
+    [[nodiscard]] size_type capacity()  const noexcept { return capacity_;  }
+
+    /// Returns `true` if a kumi::soa_vector contains no rows
+    [[nodiscard]] bool      empty()     const noexcept { return size_ == 0; }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @name Modifiers
+    //! @{
+    //==============================================================================================
+
+    //==============================================================================================
+    //! @brief Increase the capacity of a kumi::soa_vector to at least `n` rows
+    //!
+    //! Like `std::vector::reserve`, if an exception is thrown, this function has no effect unless
+    //! the exception was thrown by the move constructor of a non-copyable element type.
+    //==============================================================================================
+    void reserve(size_type n)
+    {
+      if(n > capacity_) reallocate<false>(n);
+    }
+
+    //==============================================================================================
+    //! @brief Changes the number of rows stored
+    //!
+    //! If `n` is greater than the current size, value-initialized rows are appended.
+    //==============================================================================================
+    void resize(size_type n)
+    {
+      if(n < size_)
+      {
+        kumi::for_each([&](auto* col) { std::destroy(col + n, col + size_); }, data_);
+        size_ = n;
+      }
+      else
+      {
+        reserve(n);
+        while(size_ < n) emplace_back();
+      }
+    }
+
+    /// Removes all rows from a kumi::soa_vector
+    void clear() noexcept { resize(0); }
+
+    //==============================================================================================
+    //! @brief Appends a new row constructed from the elements of a kumi::product_type
+    //==============================================================================================
+    template<sized_product_type<sizeof...(Ts)> Row> void push_back(Row&& row)
+    {
+      kumi::apply([&](auto&&... vs) { emplace_back(std::forward<decltype(vs)>(vs)...); }
+                 , std::forward<Row>(row)
+                 );
+    }
+
+    //==============================================================================================
+    //! @brief Appends a new row constructed in place from `vs`
+    //!
+    //! If no arguments are passed, each element of the new row is value-initialized.
+    //==============================================================================================
+    template<typename... Us>
+    requires( (sizeof...(Us) == 0) || (sizeof...(Us) == sizeof...(Ts)) )
+    reference emplace_back(Us&&... vs)
+    {
+      // The new row is built before the current rows are moved, as vs may refer to them
+      if(size_ != capacity_)  construct(data_, std::forward<Us>(vs)...);
+      else reallocate<true>(capacity_ ? 2 * capacity_ : 8, std::forward<Us>(vs)...);
+
+      return (*this)[size_++];
+    }
+
+    /// Removes the last row of a non-empty kumi::soa_vector
+    void pop_back() noexcept { resize(size_ - 1); }
+
+    /// Exchanges the contents of two kumi::soa_vector
+    void swap(soa_vector& other) noexcept
+    {
+      std::swap(data_     , other.data_     );
+      std::swap(size_     , other.size_     );
+      std::swap(capacity_ , other.capacity_ );
+    }
+
+    //==============================================================================================
+    //! @}
+    //==============================================================================================
+
+    private:
+    template<typename T>
+    static constexpr std::align_val_t align_of{alignof(T) > alignment ? alignof(T) : alignment};
+
+    template<typename T> static T* allocate(size_type n)
+    {
+      return static_cast<T*>(::operator new(n * sizeof(T), align_of<T>));
+    }
+
+    // Builds a new row after the last one in cols, destroying its elements if any throws
+    template<typename... Us> void construct(kumi::tuple<Ts*...>& cols, Us&&... vs)
+    {
+      std::size_t built = 0;
+      try
+      {
+        if constexpr(sizeof...(Us) == 0)
+        {
+          kumi::for_each([&](auto* col) { std::construct_at(col + size_); ++built; }, cols);
+        }
+        else
+        {
+          kumi::for_each( [&]<typename T, typename U>(T* col, U&& v)
+                          {
+                            std::construct_at(col + size_, std::forward<U>(v));
+                            ++built;
+                          }
+                        , cols, kumi::forward_as_tuple(std::forward<Us>(vs)...)
+                        );
+        }
+      }
+      catch(...)
+      {
+        kumi::for_each_index( [&](auto i, auto* col) { if(i < built) std::destroy_at(col + size_); }
+                            , cols
+                            );
+        throw;
+      }
+    }
+
+    // Columns whose elements are copied rather than moved on reallocation, as std::vector does
+    template<typename T>
+    static constexpr bool copied = !std::is_nothrow_move_constructible_v<T>
+                                && std::is_copy_constructible_v<T>;
+
+    // Copies or moves the rows into fresh. Copied columns are processed first so that, if any
+    // element throws, no row has been moved from yet and the columns built so far are destroyed.
+    void transfer(kumi::tuple<Ts*...>& fresh)
+    {
+      bool done[sizeof...(Ts) + 1] = {};
+      auto process = [&]<bool Copy>(std::bool_constant<Copy>)
+      {
+        kumi::for_each_index( [&]<typename T>(auto i, T* dst, T* src)
+                              {
+                                if constexpr(copied<T> == Copy)
+                                {
+                                  if constexpr(Copy)  std::uninitialized_copy(src, src + size_, dst);
+                                  else                std::uninitialized_move(src, src + size_, dst);
+                                  done[i] = true;
+                                }
+                              }
+                            , fresh, data_
+                            );
+      };
+
+      try
+      {
+        process(std::true_type{});
+        process(std::false_type{});
+      }
+      catch(...)
+      {
+        kumi::for_each_index( [&](auto i, auto* col) { if(done[i]) std::destroy(col, col + size_); }
+                            , fresh
+                            );
+        throw;
+      }
+    }
+
+    // Moves the rows to new columns of n rows, after appending a row built from vs if required.
+    // If an exception is thrown, the kumi::soa_vector is left unchanged unless it was thrown by
+    // the move constructor of a non-copyable element type.
+    template<bool Append, typename... Us> void reallocate(size_type n, Us&&... vs)
+    {
+      kumi::tuple<Ts*...> fresh = {};
+      bool appended = false;
+      try
+      {
+        kumi::for_each([n]<typename T>(T*& col) { col = allocate<T>(n); }, fresh);
+        if constexpr(Append) { construct(fresh, std::forward<Us>(vs)...); appended = true; }
+        transfer(fresh);
+      }
+      catch(...)
+      {
+        if(appended) kumi::for_each([&](auto* col) { std::destroy_at(col + size_); }, fresh);
+        release(fresh);
+        throw;
+      }
+
+      kumi::for_each([&](auto* col) { std::destroy(col, col + size_); }, data_);
+      release(data_);
+      data_     = fresh;
+      capacity_ = n;
+    }
+
+    static void release(kumi::tuple<Ts*...>& cols) noexcept
+    {
+      kumi::for_each( []<typename T>(T*& col)
+                      {
+                        if(col) ::operator delete(col, align_of<T>);
+                        col = nullptr;
+                      }
+                    , cols
+                    );
+    }
+
+    kumi::tuple<Ts*...> data_     = {};
+    size_type           size_     = 0;
+    size_type           capacity_ = 0;
+  };
+
+  //================================================================================================
+  // Iterator over the rows of a kumi::soa_vector supporting random access operations. As
+  // dereferencing it returns a kumi::tuple of references that has no common reference with
+  // kumi::tuple of values, it is only a C++17 input iterator and doesn't model any C++20
+  // iterator concept.
+  //================================================================================================
+  template<typename... Ts>
+  template<bool Const>
+  class soa_vector<Ts...>::iterator_t
+  {
+    using parent_t = std::conditional_t<Const, soa_vector const, soa_vector>;
+    friend class soa_vector::iterator_t<!Const>;
+
+    public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = soa_vector::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = std::conditional_t<Const, soa_vector::const_reference
+                                                      , soa_vector::reference
+                                                >;
+
+    iterator_t() = default;
+    iterator_t(parent_t* p, size_type i) noexcept : parent_(p), index_(i) {}
+
+    /// Converts an iterator to a const_iterator
+    iterator_t(iterator_t<!Const> const& other) noexcept requires(Const)
+              : parent_(other.parent_), index_(other.index_)
+    {}
+
+    reference operator*()                     const noexcept { return (*parent_)[index_];     }
+    reference operator[](difference_type n)   const noexcept { return (*parent_)[index_ + n]; }
+
+    iterator_t& operator++()    noexcept { ++index_; return *this; }
+    iterator_t& operator--()    noexcept { --index_; return *this; }
+    iterator_t  operator++(int) noexcept { auto that = *this; ++index_; return that; }
+    iterator_t  operator--(int) noexcept { auto that = *this; --index_; return that; }
+
+    iterator_t& operator+=(difference_type n) noexcept { index_ += n; return *this; }
+    iterator_t& operator-=(difference_type n) noexcept { index_ -= n; return *this; }
+
+    friend iterator_t operator+(iterator_t it, difference_type n) noexcept { return it += n; }
+    friend iterator_t operator+(difference_type n, iterator_t it) noexcept { return it += n; }
+    friend iterator_t operator-(iterator_t it, difference_type n) noexcept { return it -= n; }
+
+    friend difference_type operator-(iterator_t const& a, iterator_t const& b) noexcept
+    {
+      return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+    }
+
+    friend bool operator==(iterator_t const& a, iterator_t const& b) noexcept
+    {
+      return a.index_ == b.index_;
+    }
+
+    friend auto operator<=>(iterator_t const& a, iterator_t const& b) noexcept
+    {
+      return a.index_ <=> b.index_;
+    }
+
+    private:
+    parent_t* parent_ = nullptr;
+    size_type index_  = 0;
+  };
+}
+
+#endif
@@ -0,0 +1,126 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_SPAN_HPP_INCLUDED
+#define KUMI_SPAN_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace kumi
+{
+  namespace detail
+  {
+    // The leaves of a kumi::tuple are laid out in the same order, for any type, so checking that a
+    // tuple of N std::size_t has the object representation of an array of N std::size_t is enough
+    // to validate the ordering of its elements.
+    template<std::size_t N> constexpr bool has_array_layout() noexcept
+    {
+      return []<std::size_t... I>(std::index_sequence<I...>)
+      {
+        using tuple_t = kumi::tuple<decltype(I)...>;
+        using array_t = std::array<std::size_t, N>;
+
+        if constexpr(sizeof(tuple_t) != sizeof(array_t) || !std::is_trivially_copyable_v<tuple_t>)
+        {
+          return false;
+        }
+        else
+        {
+          auto const values = std::bit_cast<array_t>(tuple_t{I...});
+          return ((values[I] == I) && ...);
+        }
+      }(std::make_index_sequence<N>{});
+    }
+
+    template<typename T> constexpr bool is_contiguous() noexcept
+    {
+      using type = element_t<0,T>;
+
+      if constexpr(!is_kumi_tuple<T> || !std::is_object_v<type> || std::is_empty_v<type>)
+        return false;
+      else
+        return  sizeof(T)  == size<T>::value * sizeof(type)
+            &&  alignof(T) == alignof(type)
+            &&  has_array_layout<size<T>::value>();
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup tuple
+  //! @brief Concept specifying a type is a kumi::tuple whose elements are laid out as an array
+  //!
+  //! A type `T` satisfies kumi::contiguous_product_type if and only if it is a
+  //! kumi::homogeneous_product_type instance of kumi::tuple whose element type is a non-empty
+  //! object type and whose elements are stored in order, without padding, as in a C array.
+  //! This property is checked at compile time.
+  //================================================================================================
+  template<typename T>
+  concept contiguous_product_type =   homogeneous_product_type<T>
+                                  &&  detail::is_contiguous<std::remove_cvref_t<T>>();
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Access the elements of a kumi::contiguous_product_type as a fixed-size `std::span`
+  //!
+  //! No element is copied: modifying the elements of the span modifies the elements of `t`.
+  //!
+  //! @param  t kumi::contiguous_product_type to access
+  //! @return A `std::span` of `kumi::size<Tuple>::value` elements referencing the elements of t.
+  //!
+  //! ## Example
+  //! @include doc/as_span.cpp
+  //================================================================================================
+  template<contiguous_product_type Tuple>
+  [[nodiscard]] constexpr auto as_span(Tuple& t) noexcept
+  {
+    using type = std::remove_reference_t<decltype(get<0>(t))>;
+    return std::span<type, size<Tuple>::value>(&get<0>(t), size<Tuple>::value);
+  }
+
+  /// @overload
+  template<contiguous_product_type Tuple> void as_span(Tuple const&& t) = delete;
+
+  //================================================================================================
+  //! @ingroup utility
+  //! @brief Copies the elements of a kumi::homogeneous_product_type into a `std::array`
+  //!
+  //! kumi::contiguous_product_type of arithmetic values are copied as a whole. Other
+  //! kumi::homogeneous_product_type are copied, or moved if `t` is an rvalue, element-wise.
+  //!
+  //! @param  t kumi::homogeneous_product_type to convert
+  //! @return A `std::array` containing the elements of t in order.
+  //!
+  //! ## Example
+  //! @include doc/as_span.cpp
+  //================================================================================================
+  template<homogeneous_product_type Tuple>
+  [[nodiscard]] constexpr auto as_array(Tuple&& t)
+  {
+    using type    = std::remove_cvref_t<element_t<0,Tuple>>;
+    using array_t = std::array<type, size<Tuple>::value>;
+
+    if constexpr(contiguous_product_type<Tuple> && std::is_arithmetic_v<type>)
+    {
+      return std::bit_cast<array_t>(t);
+    }
+    else
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        return array_t{ get<I>(std::forward<Tuple>(t))... };
+      }(std::make_index_sequence<size<Tuple>::value>{});
+    }
+  }
+}
+
+#endif
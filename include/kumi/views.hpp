@@ -0,0 +1,488 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#ifndef KUMI_VIEWS_HPP_INCLUDED
+#define KUMI_VIEWS_HPP_INCLUDED
+
+#include <kumi/tuple.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace kumi
+{
+  namespace views
+  {
+    //==============================================================================================
+    //! @ingroup tuple
+    //! @class view
+    //! @brief Lazy kumi::product_type whose elements are computed from other kumi::product_type
+    //!
+    //! A kumi::views::view stores its source kumi::product_type, by reference if they were passed
+    //! as lvalues and by value otherwise, and resolves each of its elements to the corresponding
+    //! element of its sources at compile time. Elements of a view are never copied: accessing
+    //! them returns references to the elements of the sources or, for kumi::views::zip,
+    //! kumi::views::transpose and kumi::views::cartesian_product, a kumi::tuple of such references.
+    //!
+    //! The element types of a view, as reported by `std::tuple_element`, are the types of the
+    //! elements of its sources. kumi::to_tuple turns a view into a kumi::tuple of such types,
+    //! copying the elements of the sources only at this point.
+    //!
+    //! kumi::views::view are built by kumi::views::cat, kumi::views::zip, kumi::views::reorder,
+    //! kumi::views::transpose and kumi::views::cartesian_product and can be passed to any
+    //! algorithm expecting a kumi::product_type.
+    //!
+    //! @tparam Access  Type describing how elements are accessed
+    //! @tparam Sources Types of the stored kumi::product_type
+    //==============================================================================================
+    template<typename Access, typename... Sources> struct view
+    {
+      using is_product_type = void;
+      using is_lazy_view    = void;
+
+      kumi::tuple<Sources...> sources;
+
+      /// Returns the number of elements in a kumi::views::view
+      static constexpr auto size() noexcept
+      {
+        return Access::template size<std::remove_cvref_t<Sources>...>;
+      }
+
+      /// Returns `true` if a kumi::views::view contains 0 elements
+      static constexpr bool empty() noexcept { return size() == 0; }
+
+      //============================================================================================
+      //! @brief Access the Ith element of a kumi::views::view
+      //! @param  i Compile-time index of the element to access
+      //! @return A reference to the selected element or a kumi::tuple of such references.
+      //============================================================================================
+      template<std::size_t I>
+      requires(I < size()) constexpr decltype(auto) operator[](index_t<I>) & noexcept
+      {
+        return Access::template fetch<I>(sources);
+      }
+
+      /// @overload
+      template<std::size_t I>
+      requires(I < size()) constexpr decltype(auto) operator[](index_t<I>) && noexcept
+      {
+        return Access::template fetch<I>(static_cast<kumi::tuple<Sources...>&&>(sources));
+      }
+
+      /// @overload
+      template<std::size_t I>
+      requires(I < size()) constexpr decltype(auto) operator[](index_t<I>) const& noexcept
+      {
+        return Access::template fetch<I>(sources);
+      }
+
+      /// @overload
+      template<std::size_t I>
+      requires(I < size()) constexpr decltype(auto) operator[](index_t<I>) const&& noexcept
+      {
+        return Access::template fetch<I>(static_cast<kumi::tuple<Sources...> const&&>(sources));
+      }
+    };
+
+    //==============================================================================================
+    //! @ingroup tuple
+    //! @related kumi::views::view
+    //! @brief Extracts the Ith element from a kumi::views::view
+    //==============================================================================================
+    template<std::size_t I, typename A, typename... Ss>
+    requires(I < view<A,Ss...>::size())
+    [[nodiscard]] constexpr decltype(auto) get(view<A,Ss...>& v) noexcept
+    {
+      return v[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I, typename A, typename... Ss>
+    requires(I < view<A,Ss...>::size())
+    [[nodiscard]] constexpr decltype(auto) get(view<A,Ss...>&& v) noexcept
+    {
+      return static_cast<view<A,Ss...>&&>(v)[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I, typename A, typename... Ss>
+    requires(I < view<A,Ss...>::size())
+    [[nodiscard]] constexpr decltype(auto) get(view<A,Ss...> const& v) noexcept
+    {
+      return v[index<I>];
+    }
+
+    /// @overload
+    template<std::size_t I, typename A, typename... Ss>
+    requires(I < view<A,Ss...>::size())
+    [[nodiscard]] constexpr decltype(auto) get(view<A,Ss...> const&& v) noexcept
+    {
+      return static_cast<view<A,Ss...> const&&>(v)[index<I>];
+    }
+  }
+
+  namespace detail
+  {
+    template<typename T>
+    concept lazy_view =   product_type<T>
+                      &&  requires { typename std::remove_cvref_t<T>::is_lazy_view; };
+
+    // Gather the Ith element of each product type in a tuple without copying them
+    template<std::size_t I, typename Tuple> constexpr auto gather(Tuple&& ts) noexcept
+    {
+      return kumi::apply( []<typename... Ts>(Ts&&... t)
+                          {
+                            return kumi::tuple<decltype(get<I>(std::forward<Ts>(t)))...>
+                                   { get<I>(std::forward<Ts>(t))... };
+                          }
+                        , std::forward<Tuple>(ts)
+                        );
+    }
+
+    struct cat_access
+    {
+      template<typename... Ts>
+      static constexpr std::size_t size = (0ULL + ... + kumi::size<Ts>::value);
+
+      template<typename... Ts> static constexpr auto positions = []()
+      {
+        // count is at least 1 so we never build a 0-sized array
+        struct { std::size_t t[size<Ts...> + 1], e[size<Ts...> + 1]; } that{};
+        std::size_t k = 0, offset = 0;
+
+        auto locate = [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+          (((that.t[I+offset] = k),(that.e[I+offset] = I)),...);
+          offset += sizeof...(I);
+          k++;
+        };
+
+        (locate(std::make_index_sequence<kumi::size<Ts>::value>{}),...);
+        return that;
+      }();
+
+      template<std::size_t I, typename Sources>
+      static constexpr decltype(auto) fetch(Sources&& s) noexcept
+      {
+        constexpr auto pos = []<typename... Ts>(kumi::tuple<Ts...> const*)
+        {
+          return positions<std::remove_cvref_t<Ts>...>;
+        }(static_cast<std::remove_cvref_t<Sources>*>(nullptr));
+
+        return get<pos.e[I]>(get<pos.t[I]>(std::forward<Sources>(s)));
+      }
+
+      template<std::size_t I, typename... Ts>
+      using element = element_t< positions<Ts...>.e[I]
+                               , element_t<positions<Ts...>.t[I], kumi::tuple<Ts...>>
+                               >;
+    };
+
+    struct zip_access
+    {
+      template<typename T, typename... Ts>
+      static constexpr std::size_t size = kumi::size<T>::value;
+
+      template<std::size_t I, typename Sources>
+      static constexpr auto fetch(Sources&& s) noexcept
+      {
+        return gather<I>(std::forward<Sources>(s));
+      }
+
+      template<std::size_t I, typename... Ts>
+      using element = kumi::tuple<element_t<I,Ts>...>;
+    };
+
+    template<std::size_t... Idx> struct reorder_access
+    {
+      static constexpr std::size_t indexes[sizeof...(Idx) + 1] = {Idx...};
+
+      template<typename T>
+      static constexpr std::size_t size = sizeof...(Idx);
+
+      template<std::size_t I, typename Sources>
+      static constexpr decltype(auto) fetch(Sources&& s) noexcept
+      {
+        return get<indexes[I]>(get<0>(std::forward<Sources>(s)));
+      }
+
+      template<std::size_t I, typename T>
+      using element = element_t<indexes[I], T>;
+    };
+
+    struct transpose_access
+    {
+      template<typename T> static constexpr std::size_t rows() noexcept
+      {
+        if constexpr(sized_product_type<T,0>) return 0;
+        else return kumi::size<std::remove_cvref_t<element_t<0,T>>>::value;
+      }
+
+      template<typename T>
+      static constexpr std::size_t size = rows<T>();
+
+      template<std::size_t I, typename Sources>
+      static constexpr auto fetch(Sources&& s) noexcept
+      {
+        return gather<I>(get<0>(std::forward<Sources>(s)));
+      }
+
+      template< std::size_t I, typename T
+              , typename K = std::make_index_sequence<kumi::size<T>::value>
+              >
+      struct column;
+
+      template<std::size_t I, typename T, std::size_t... K>
+      struct column<I, T, std::index_sequence<K...>>
+      {
+        using type = kumi::tuple<element_t<I, std::remove_cvref_t<element_t<K,T>>>...>;
+      };
+
+      template<std::size_t I, typename T>
+      using element = typename column<I,T>::type;
+    };
+
+    struct cartesian_product_access
+    {
+      template<typename... Ts>
+      static constexpr std::size_t size = (1ULL * ... * kumi::size<Ts>::value);
+
+      // Mixed-radix decoding of a combination index, the first source varying the fastest
+      template<std::size_t K, typename... Ts>
+      static constexpr auto indexes = digits<sizeof...(Ts), kumi::size<Ts>::value...>(K);
+
+      template<std::size_t K, typename Sources>
+      static constexpr auto fetch(Sources&& s) noexcept
+      {
+        constexpr auto dg = []<typename... Ts>(kumi::tuple<Ts...> const*)
+        {
+          return indexes<K, std::remove_cvref_t<Ts>...>;
+        }(static_cast<std::remove_cvref_t<Sources>*>(nullptr));
+
+        constexpr auto n = []<typename... Ts>(kumi::tuple<Ts...> const*)
+        {
+          return size<std::remove_cvref_t<Ts>...>;
+        }(static_cast<std::remove_cvref_t<Sources>*>(nullptr));
+
+        return [&]<std::size_t... J>(std::index_sequence<J...>)
+        {
+          return kumi::tuple<decltype(get<dg.data[J]>(source<J,n>(std::forward<Sources>(s))))...>
+                 { get<dg.data[J]>(source<J,n>(std::forward<Sources>(s)))... };
+        }(std::make_index_sequence<kumi::size<Sources>::value>{});
+      }
+
+      // The Jth source is only accessed as an rvalue if each of its elements belongs to a single
+      // combination of the N ones, i.e if every other source holds one element.
+      template<std::size_t J, std::size_t N, typename Sources>
+      static constexpr decltype(auto) source(Sources&& s) noexcept
+      {
+        auto&& src  = get<J>(std::forward<Sources>(s));
+        using type  = decltype(src);
+        if constexpr(!std::is_lvalue_reference_v<type> && kumi::size<type>::value == N)
+          return static_cast<type>(src);
+        else
+          return (src);
+      }
+
+      template< std::size_t K, typename Ts
+              , typename J = std::make_index_sequence<kumi::size<Ts>::value>
+              >
+      struct combination;
+
+      template<std::size_t K, typename... Ts, std::size_t... J>
+      struct combination<K, kumi::tuple<Ts...>, std::index_sequence<J...>>
+      {
+        using type = kumi::tuple<element_t<indexes<K,Ts...>.data[J], Ts>...>;
+      };
+
+      template<std::size_t K, typename... Ts>
+      using element = typename combination<K, kumi::tuple<Ts...>>::type;
+    };
+
+    // Cartesian product of references to ts, without moving them into the view
+    template<typename... Ts> constexpr auto combinations(Ts&&... ts) noexcept
+    {
+      return views::view<cartesian_product_access, Ts&&...>{ {std::forward<Ts>(ts)...} };
+    }
+
+    // Copies a view element into its value type
+    template<typename E, typename V> constexpr E materialize(V&& v)
+    {
+      if constexpr(product_type<E> && !std::same_as<std::remove_cvref_t<V>, E>)
+      {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+          return E{ materialize<element_t<I,E>>(get<I>(std::forward<V>(v)))... };
+        }(std::make_index_sequence<size<E>::value>{});
+      }
+      else return std::forward<V>(v);
+    }
+  }
+
+  namespace views
+  {
+    //==============================================================================================
+    //! @ingroup generators
+    //! @brief Lazily concatenates multiple kumi::product_type
+    //!
+    //! @param ts kumi::product_type to concatenate
+    //! @return A kumi::views::view equivalent to kumi::cat(ts...) referencing the elements of ts.
+    //!
+    //! ## Example
+    //! @include doc/views.cpp
+    //==============================================================================================
+    template<product_type... Tuples> [[nodiscard]] constexpr auto cat(Tuples&&... ts)
+    {
+      return view<detail::cat_access, Tuples...>{ {std::forward<Tuples>(ts)...} };
+    }
+
+    //==============================================================================================
+    //! @ingroup generators
+    //! @brief Lazily constructs a view of tuples by aggregating elements from multiple
+    //!        kumi::product_type
+    //!
+    //! @param t0     kumi::product_type to zip
+    //! @param others Other kumi::product_type of the same size to zip
+    //! @return A kumi::views::view whose Ith element is a kumi::tuple of references to the Ith
+    //!         element of t0 and others.
+    //!
+    //! ## Example
+    //! @include doc/views.cpp
+    //==============================================================================================
+    template<product_type T0, sized_product_type<size<T0>::value>... Ts>
+    [[nodiscard]] constexpr auto zip(T0&& t0, Ts&&... others)
+    {
+      return view<detail::zip_access, T0, Ts...>
+             { {std::forward<T0>(t0), std::forward<Ts>(others)...} };
+    }
+
+    //==============================================================================================
+    //! @ingroup generators
+    //! @brief Lazily reorders the elements of a kumi::product_type
+    //!
+    //! @tparam Idx Reordered index of elements
+    //! @param  t   kumi::product_type to reorder
+    //! @return A kumi::views::view equivalent to kumi::reorder<Idx...>(t) referencing the elements
+    //!         of t.
+    //!
+    //! ## Example
+    //! @include doc/views.cpp
+    //==============================================================================================
+    template<std::size_t... Idx, product_type Tuple>
+    requires((Idx < size<Tuple>::value) && ...)
+    [[nodiscard]] constexpr auto reorder(Tuple&& t)
+    {
+      return view<detail::reorder_access<Idx...>, Tuple>{ {std::forward<Tuple>(t)} };
+    }
+
+    //==============================================================================================
+    //! @ingroup generators
+    //! @brief Lazily transposes a kumi::product_type of kumi::product_type of the same size
+    //!
+    //! @param t kumi::product_type to transpose
+    //! @return A kumi::views::view whose Ith element is a kumi::tuple of references to the Ith
+    //!         element of each element of t.
+    //!
+    //! ## Example
+    //! @include doc/views.cpp
+    //==============================================================================================
+    template<product_type Tuple> [[nodiscard]] constexpr auto transpose(Tuple&& t)
+    {
+      return view<detail::transpose_access, Tuple>{ {std::forward<Tuple>(t)} };
+    }
+
+    //==============================================================================================
+    //! @ingroup generators
+    //! @brief Lazily computes the Cartesian Product of multiple kumi::product_type
+    //!
+    //! The Kth element of the resulting view is computed only when accessed, by decoding K as a
+    //! mixed-radix number whose digits are the indexes of the selected element in each source,
+    //! the first source varying the fastest.
+    //!
+    //! @param t0     kumi::product_type to process
+    //! @param others Other kumi::product_type to process
+    //! @return A kumi::views::view equivalent to kumi::cartesian_product(t0, others...) whose
+    //!         elements are kumi::tuple of references to the elements of t0 and others.
+    //!
+    //! ## Example
+    //! @include doc/for_each_combination.cpp
+    //==============================================================================================
+    template<product_type T0, product_type... Ts>
+    [[nodiscard]] constexpr auto cartesian_product(T0&& t0, Ts&&... others)
+    {
+      return view<detail::cartesian_product_access, T0, Ts...>
+             { {std::forward<T0>(t0), std::forward<Ts>(others)...} };
+    }
+  }
+
+  //================================================================================================
+  //! @ingroup transforms
+  //! @brief Applies the Callable object f on each combination of elements of multiple
+  //!        kumi::product_type
+  //!
+  //! Calls `f(e0, es...)` for each element of kumi::views::cartesian_product(t0, ts...) without
+  //! copying any element of t0 or ts.
+  //!
+  //! @param f  Callable object to be invoked
+  //! @param t0 kumi::product_type to process
+  //! @param ts Other kumi::product_type to process
+  //!
+  //! ## Example
+  //! @include doc/for_each_combination.cpp
+  //================================================================================================
+  template<typename Function, product_type T0, product_type... Ts>
+  constexpr void for_each_combination(Function f, T0&& t0, Ts&&... ts)
+  {
+    kumi::for_each( [&](auto&& c) { kumi::apply(f, std::forward<decltype(c)>(c)); }
+                  , detail::combinations(std::forward<T0>(t0), std::forward<Ts>(ts)...)
+                  );
+  }
+
+  //================================================================================================
+  //! @brief Converts a kumi::views::view to a kumi::tuple
+  //!
+  //! Copies the elements referenced by a kumi::views::view into a kumi::tuple whose element types
+  //! are the element types of the view.
+  //!
+  //! @param  v kumi::views::view to convert
+  //! @return An instance of kumi::tuple constructed from each elements of `v` in order.
+  //!
+  //! ## Example
+  //! @include doc/views.cpp
+  //================================================================================================
+  template<detail::lazy_view View> [[nodiscard]] constexpr auto to_tuple(View&& v)
+  {
+    using type = std::remove_cvref_t<View>;
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return kumi::tuple<element_t<I,type>...>
+      { detail::materialize<element_t<I,type>>(get<I>(std::forward<View>(v)))... };
+    }(std::make_index_sequence<size<type>::value>{});
+  }
+}
+
+//==================================================================================================
+// Structured binding adaptation
+//==================================================================================================
+template<typename A, typename... Ss>
+struct  std::tuple_size<kumi::views::view<A,Ss...>>
+      : std::integral_constant<std::size_t, kumi::views::view<A,Ss...>::size()>
+{};
+
+template<std::size_t I, typename A, typename... Ss>
+struct std::tuple_element<I, kumi::views::view<A,Ss...>>
+{
+  using type = typename A::template element<I, std::remove_cvref_t<Ss>...>;
+};
+
+template<std::size_t I, typename A, typename... Ss>
+struct std::tuple_element<I, kumi::views::view<A,Ss...> const>
+{
+  using type = typename A::template element<I, std::remove_cvref_t<Ss>...> const;
+};
+
+#endif
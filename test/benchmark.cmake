@@ -0,0 +1,131 @@
+##==================================================================================================
+##  KUMI - Cmpact C++20 Tuple Toolbox
+##  Copyright : KUMI Contributors & Maintainers
+##  SPDX-License-Identifier: MIT
+##==================================================================================================
+
+##==================================================================================================
+## Compile-time benchmarks
+##
+## Every (backend, algorithm, size) triplet is compiled as its own object through a launcher that
+## records its compilation time and peak memory. Header kernels compare the cost of including
+## kumi/tuple.hpp to the cost of including only the headers they need. Run with:
+##
+##    cmake --build . --target compile-benchmark
+##==================================================================================================
+set(KUMI_BENCHMARK_SIZES      "8;16;32;64;128;256;512" CACHE STRING "Tuple arities to benchmark")
+set(KUMI_BENCHMARK_ALGORITHMS construct cat flatten_all zip transpose cartesian_product map fold_left)
+set(KUMI_BENCHMARK_HEADERS    core cat map)
+
+if(UNIX)
+  set(bench_dir   "${PROJECT_SOURCE_DIR}/test/benchmark/compile")
+  set(bench_out   "${PROJECT_BINARY_DIR}/benchmark")
+  set(bench_csv   "${bench_out}/compile.csv")
+  set(bench_stamp "${bench_out}/compile.stamp")
+
+  add_executable(kumi_compile_probe "${bench_dir}/probe.cpp")
+  set_target_properties ( kumi_compile_probe PROPERTIES
+                          RUNTIME_OUTPUT_DIRECTORY "${bench_out}$<0:>"
+                          EXCLUDE_FROM_ALL TRUE
+                        )
+
+  ## Starts each run from a clean slate so every benchmark object is recompiled
+  add_custom_target ( kumi_compile_reset
+                      COMMAND ${CMAKE_COMMAND} -E make_directory "${bench_out}"
+                      COMMAND ${CMAKE_COMMAND} -E remove -f "${bench_csv}"
+                      COMMAND ${CMAKE_COMMAND} -E touch "${bench_stamp}"
+                      BYPRODUCTS "${bench_stamp}"
+                      COMMENT "[kumi] Resetting compile-time benchmark results"
+                    )
+
+  add_custom_target ( compile-benchmark
+                      COMMAND ${CMAKE_COMMAND}
+                              "-DKUMI_BENCH_CSV=${bench_csv}"
+                              "-DKUMI_BENCH_ALGORITHMS=$<JOIN:${KUMI_BENCHMARK_ALGORITHMS},$<COMMA>>"
+                              "-DKUMI_BENCH_SIZES=$<JOIN:${KUMI_BENCHMARK_SIZES},$<COMMA>>"
+                              "-DKUMI_BENCH_HEADERS=$<JOIN:${KUMI_BENCHMARK_HEADERS},$<COMMA>>"
+                              -P "${bench_dir}/report.cmake"
+                      COMMENT "[kumi] Compile-time benchmark results"
+                      VERBATIM
+                    )
+
+  function(generate_compile_benchmark algo size backend)
+    set(target "benchmark.compile.${backend}.${algo}.${size}")
+
+    add_library(${target} OBJECT "${bench_dir}/${algo}.cpp")
+    target_link_libraries(${target} PUBLIC kumi_test)
+    target_compile_definitions(${target} PRIVATE KUMI_BENCH_SIZE=${size})
+    if(backend STREQUAL "std")
+      target_compile_definitions(${target} PRIVATE KUMI_BENCH_STD)
+    elseif(backend STREQUAL "umbrella")
+      target_compile_definitions(${target} PRIVATE KUMI_BENCH_UMBRELLA)
+    endif()
+
+    set_target_properties ( ${target} PROPERTIES
+                            EXCLUDE_FROM_ALL TRUE
+                            CXX_COMPILER_LAUNCHER
+                            "${bench_out}/kumi_compile_probe;${bench_csv};${backend},${algo},${size}"
+                          )
+
+    set_source_files_properties ( "${bench_dir}/${algo}.cpp"
+                                  PROPERTIES OBJECT_DEPENDS "${bench_stamp}"
+                                )
+
+    add_dependencies(${target} kumi_compile_probe kumi_compile_reset)
+    add_dependencies(compile-benchmark ${target})
+  endfunction()
+
+  foreach(algo IN LISTS KUMI_BENCHMARK_ALGORITHMS)
+    foreach(size IN LISTS KUMI_BENCHMARK_SIZES)
+      generate_compile_benchmark(${algo} ${size} kumi)
+      generate_compile_benchmark(${algo} ${size} std)
+    endforeach()
+  endforeach()
+
+  foreach(header IN LISTS KUMI_BENCHMARK_HEADERS)
+    generate_compile_benchmark(header_${header} 0 umbrella)
+    generate_compile_benchmark(header_${header} 0 minimal)
+  endforeach()
+else()
+  message( STATUS "[kumi] Compile-time benchmarks require a POSIX host - disabled")
+endif()
+
+##==================================================================================================
+## Runtime benchmarks
+##
+## Each kernel is compiled with optimizations and compares kumi algorithms to hand-written code
+## over the same data. Run with:
+##
+##    cmake --build . --target runtime-benchmark
+##==================================================================================================
+set(KUMI_RUNTIME_BENCHMARKS apply fold for_each less map zip)
+
+add_custom_target(runtime-benchmark)
+
+function(generate_runtime_benchmark kernel)
+  set(target "benchmark.runtime.${kernel}.exe")
+
+  add_executable(${target} "${PROJECT_SOURCE_DIR}/test/benchmark/runtime/${kernel}.cpp")
+  target_link_libraries(${target} PUBLIC kumi_test)
+
+  if (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+    target_compile_options(${target} PRIVATE /O2)
+  else()
+    target_compile_options(${target} PRIVATE -O2)
+  endif()
+
+  set_target_properties ( ${target} PROPERTIES
+                          RUNTIME_OUTPUT_DIRECTORY "${PROJECT_BINARY_DIR}/benchmark"
+                          EXCLUDE_FROM_ALL TRUE
+                        )
+
+  add_custom_command( TARGET runtime-benchmark POST_BUILD
+                      COMMAND ${CMAKE_CROSSCOMPILING_CMD} $<TARGET_FILE:${target}>
+                    )
+
+  add_dependencies(runtime-benchmark ${target})
+endfunction()
+
+foreach(kernel IN LISTS KUMI_RUNTIME_BENCHMARKS)
+  generate_runtime_benchmark(${kernel})
+endforeach()
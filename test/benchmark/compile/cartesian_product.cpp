@@ -0,0 +1,15 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "common.hpp"
+
+int main()
+{
+  auto t0 = bench::generate<bench::arity/4>();
+  auto t1 = bench::generate<4, bench::arity/4>();
+  return bench::observe(bench::cartesian_product(t0, t1));
+}
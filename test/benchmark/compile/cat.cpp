@@ -0,0 +1,15 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "common.hpp"
+
+int main()
+{
+  auto t0 = bench::generate<bench::arity/2>();
+  auto t1 = bench::generate<bench::arity/2, bench::arity/2>();
+  return bench::observe(bench::cat(t0, t1));
+}
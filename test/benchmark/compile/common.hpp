@@ -0,0 +1,166 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#if !defined(KUMI_BENCH_SIZE)
+#  define KUMI_BENCH_SIZE 8
+#endif
+
+//==================================================================================================
+// Compile-time benchmark kernels
+//
+// Each benchmark TU computes a single algorithm over tuples of KUMI_BENCH_SIZE distinct element
+// types. When KUMI_BENCH_STD is defined, the same work is performed with std::tuple and a minimal
+// implementation of the algorithm built on top of std::apply and std::tuple_cat.
+//==================================================================================================
+namespace bench
+{
+  inline constexpr std::size_t arity = KUMI_BENCH_SIZE;
+
+  template<std::size_t I> struct value { int v; };
+}
+
+#if defined(KUMI_BENCH_STD)
+#include <tuple>
+#include <type_traits>
+
+namespace bench
+{
+  using std::get;
+
+  template<typename... Ts> using tuple = std::tuple<Ts...>;
+
+  template<typename T>            struct is_tuple                   : std::false_type {};
+  template<typename... Ts>        struct is_tuple<std::tuple<Ts...>> : std::true_type {};
+
+  inline constexpr auto make_tuple = [](auto&&... ts) { return std::make_tuple(ts...); };
+
+  constexpr auto cat(auto const&... ts) { return std::tuple_cat(ts...); }
+
+  constexpr auto map(auto f, auto const& t)
+  {
+    return std::apply([&](auto const&... m) { return std::make_tuple(f(m)...); }, t);
+  }
+
+  constexpr auto fold_left(auto f, auto const& t, auto init)
+  {
+    return std::apply([&](auto const&... m) { ((init = f(init, m)), ...); return init; }, t);
+  }
+
+  template<typename T0, typename T1> constexpr auto zip(T0 const& t0, T1 const& t1)
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return std::make_tuple(std::make_tuple(get<I>(t0), get<I>(t1))...);
+    }(std::make_index_sequence<std::tuple_size_v<T0>>{});
+  }
+
+  template<typename T> constexpr auto transpose(T const& t)
+  {
+    using inner_t = std::tuple_element_t<0, T>;
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      auto column = [&]<std::size_t J>(std::integral_constant<std::size_t, J>)
+      {
+        return std::apply([](auto const&... m) { return std::make_tuple(get<J>(m)...); }, t);
+      };
+      return std::make_tuple(column(std::integral_constant<std::size_t, I>{})...);
+    }(std::make_index_sequence<std::tuple_size_v<inner_t>>{});
+  }
+
+  template<typename T> constexpr auto flatten_all(T const& t)
+  {
+    return std::apply ( [](auto const&... m)
+                        {
+                          auto v_or_t = []<typename V>(V const& v)
+                          {
+                            if constexpr(is_tuple<V>::value) return flatten_all(v);
+                            else                             return std::make_tuple(v);
+                          };
+                          return std::tuple_cat(v_or_t(m)...);
+                        }
+                      , t
+                      );
+  }
+
+  template<typename T0, typename T1>
+  constexpr auto cartesian_product(T0 const& t0, T1 const& t1)
+  {
+    constexpr auto n1 = std::tuple_size_v<T1>;
+    return [&]<std::size_t... K>(std::index_sequence<K...>)
+    {
+      return std::make_tuple(std::make_tuple(get<K / n1>(t0), get<K % n1>(t1))...);
+    }(std::make_index_sequence<std::tuple_size_v<T0> * n1>{});
+  }
+}
+#else
+#include <kumi/tuple.hpp>
+
+namespace bench
+{
+  using kumi::get;
+  using kumi::tuple;
+  using kumi::cat;
+  using kumi::map;
+  using kumi::fold_left;
+  using kumi::zip;
+  using kumi::transpose;
+  using kumi::flatten_all;
+  using kumi::cartesian_product;
+
+  inline constexpr auto make_tuple = [](auto&&... ts) { return kumi::make_tuple(ts...); };
+}
+#endif
+
+namespace bench
+{
+  //================================================================================================
+  // Generates a tuple of N distinct value types starting at value<Offset>
+  //================================================================================================
+  template<std::size_t N, std::size_t Offset = 0> constexpr auto generate()
+  {
+    return []<std::size_t... I>(std::index_sequence<I...>)
+    {
+      return tuple<value<Offset + I>...>{value<Offset + I>{int(I)}...};
+    }(std::make_index_sequence<N>{});
+  }
+
+  //================================================================================================
+  // Generates a tuple of N/4 two-level nested tuples, totaling N leaves
+  //================================================================================================
+  template<std::size_t N> constexpr auto generate_nested()
+  {
+    return []<std::size_t... I>(std::index_sequence<I...>)
+    {
+      auto pair = [](auto a, auto b) { return make_tuple(a, b); };
+      return make_tuple ( make_tuple( pair(value<4*I+0>{0}, value<4*I+1>{1})
+                                    , pair(value<4*I+2>{2}, value<4*I+3>{3})
+                                    )...
+                        );
+    }(std::make_index_sequence<N/4>{});
+  }
+
+  //================================================================================================
+  // Generates a tuple of 8 tuples of N/8 elements, totaling N leaves
+  //================================================================================================
+  template<std::size_t N> constexpr auto generate_matrix()
+  {
+    return []<std::size_t... R>(std::index_sequence<R...>)
+    {
+      return make_tuple(generate<N/8, R*(N/8)>()...);
+    }(std::make_index_sequence<8>{});
+  }
+
+  //================================================================================================
+  // Prevents the computed result to be discarded
+  //================================================================================================
+  template<typename T> int observe(T const& t) { return static_cast<int>(sizeof(t)); }
+}
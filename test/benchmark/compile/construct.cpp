@@ -0,0 +1,14 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "common.hpp"
+
+int main()
+{
+  auto t = bench::generate<bench::arity>();
+  return bench::observe(t);
+}
@@ -0,0 +1,19 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+// Cost of including kumi to only use kumi::cat
+#if defined(KUMI_BENCH_UMBRELLA)
+#  include <kumi/tuple.hpp>
+#else
+#  include <kumi/algorithm/cat.hpp>
+#endif
+
+int main()
+{
+  auto t = kumi::cat(kumi::tuple{1, 2.5}, kumi::tuple{'z'});
+  return static_cast<int>(t.size()) - kumi::get<0>(t);
+}
@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+// Cost of including kumi to only use kumi::tuple, kumi::get and kumi::apply
+#if defined(KUMI_BENCH_UMBRELLA)
+#  include <kumi/tuple.hpp>
+#else
+#  include <kumi/core.hpp>
+#endif
+
+int main()
+{
+  kumi::tuple t{1, 2.5, 'z'};
+  auto sum = kumi::apply([](auto... m) { return (0 + ... + static_cast<int>(m)); }, t);
+  return sum - kumi::get<0>(t);
+}
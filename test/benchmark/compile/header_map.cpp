@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+// Cost of including kumi to only use kumi::map and kumi::fold_left
+#if defined(KUMI_BENCH_UMBRELLA)
+#  include <kumi/tuple.hpp>
+#else
+#  include <kumi/algorithm/fold.hpp>
+#  include <kumi/algorithm/map.hpp>
+#endif
+
+int main()
+{
+  auto t = kumi::map([](auto m) { return static_cast<int>(m) * 2; }, kumi::tuple{1, 2.5, 'z'});
+  return kumi::fold_left([](int acc, int m) { return acc + m; }, t, 0);
+}
@@ -0,0 +1,64 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <chrono>
+#include <cstdio>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//==================================================================================================
+// Compiler launcher recording wall-clock time and peak resident memory of a compilation.
+//
+// Usage: probe <output.csv> <label> <compiler> <args...>
+//
+// Appends a line '<label>,<milliseconds>,<peak KiB>' to output.csv and forwards the compiler
+// exit status.
+//==================================================================================================
+int main(int argc, char** argv)
+{
+  if(argc < 4)
+  {
+    std::fprintf(stderr, "usage: %s <output.csv> <label> <compiler> <args...>\n", argv[0]);
+    return 1;
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+
+  pid_t pid = fork();
+  if(pid < 0)
+  {
+    std::perror("[kumi] fork");
+    return 1;
+  }
+
+  if(pid == 0)
+  {
+    execvp(argv[3], argv + 3);
+    std::perror("[kumi] execvp");
+    _exit(127);
+  }
+
+  int     status = 0;
+  rusage  usage  = {};
+  if(wait4(pid, &status, 0, &usage) < 0)
+  {
+    std::perror("[kumi] wait4");
+    return 1;
+  }
+
+  auto const stop = std::chrono::steady_clock::now();
+  auto const ms   = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count();
+
+  if(std::FILE* out = std::fopen(argv[1], "a"))
+  {
+    std::fprintf(out, "%s,%lld,%ld\n", argv[2], static_cast<long long>(ms), usage.ru_maxrss);
+    std::fclose(out);
+  }
+
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
@@ -0,0 +1,122 @@
+##==================================================================================================
+##  KUMI - Compact C++20 Tuple Toolbox
+##  Copyright : KUMI Contributors & Maintainers
+##  SPDX-License-Identifier: MIT
+##==================================================================================================
+
+##==================================================================================================
+## Summarize compile-time benchmark results
+##
+## Expects: KUMI_BENCH_CSV, KUMI_BENCH_ALGORITHMS, KUMI_BENCH_SIZES, KUMI_BENCH_HEADERS
+## Each CSV line is: backend,algorithm,size,milliseconds,peak KiB
+##==================================================================================================
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT EXISTS "${KUMI_BENCH_CSV}")
+  message(FATAL_ERROR "[kumi] No benchmark results found in ${KUMI_BENCH_CSV}")
+endif()
+
+string(REPLACE "," ";" algorithms "${KUMI_BENCH_ALGORITHMS}")
+string(REPLACE "," ";" sizes      "${KUMI_BENCH_SIZES}")
+string(REPLACE "," ";" headers    "${KUMI_BENCH_HEADERS}")
+
+file(STRINGS "${KUMI_BENCH_CSV}" lines)
+foreach(line IN LISTS lines)
+  string(REPLACE "," ";" fields "${line}")
+  list(GET fields 0 backend)
+  list(GET fields 1 algo)
+  list(GET fields 2 size)
+  list(GET fields 3 ms)
+  list(GET fields 4 kb)
+  set(result_${backend}_${algo}_${size}_ms ${ms})
+  set(result_${backend}_${algo}_${size}_kb ${kb})
+endforeach()
+
+function(pad out text width)
+  string(LENGTH "${text}" len)
+  math(EXPR missing "${width} - ${len}")
+  if(missing GREATER 0)
+    string(REPEAT " " ${missing} spaces)
+    set(text "${spaces}${text}")
+  endif()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+function(cell out value)
+  if("${value}" STREQUAL "")
+    set(value "-")
+  endif()
+  pad(value "${value}" 12)
+  set(${out} "${value}" PARENT_SCOPE)
+endfunction()
+
+set(header "algorithm         size   kumi [ms]    std [ms]  kumi [KiB]   std [KiB]  time ratio")
+message("${header}")
+string(REGEX REPLACE "." "-" rule "${header}")
+message("${rule}")
+
+foreach(algo IN LISTS algorithms)
+  foreach(size IN LISTS sizes)
+    set(km "${result_kumi_${algo}_${size}_ms}")
+    set(sm "${result_std_${algo}_${size}_ms}")
+    set(kk "${result_kumi_${algo}_${size}_kb}")
+    set(sk "${result_std_${algo}_${size}_kb}")
+
+    set(ratio "")
+    if(NOT "${km}" STREQUAL "" AND NOT "${sm}" STREQUAL "" AND sm GREATER 0)
+      math(EXPR ratio "(100 * ${km}) / ${sm}")
+      set(ratio "${ratio}%")
+    endif()
+
+    string(LENGTH "${algo}" len)
+    math(EXPR fill "18 - ${len}")
+    string(REPEAT " " ${fill} spaces)
+    pad(sz "${size}" 4)
+    cell(km "${km}")
+    cell(sm "${sm}")
+    cell(kk "${kk}")
+    cell(sk "${sk}")
+    cell(ratio "${ratio}")
+    message("${algo}${spaces}${sz}${km}${sm}${kk}${sk}${ratio}")
+  endforeach()
+endforeach()
+
+message("${rule}")
+
+##==================================================================================================
+## Header kernels: kumi/tuple.hpp versus the minimal set of headers
+##==================================================================================================
+if(headers)
+  message("")
+  set(header "header      tuple.hpp [ms] minimal [ms]    tuple.hpp [KiB]  minimal [KiB]  time ratio")
+  message("${header}")
+  string(REGEX REPLACE "." "-" rule "${header}")
+  message("${rule}")
+
+  foreach(kernel IN LISTS headers)
+    set(um "${result_umbrella_header_${kernel}_0_ms}")
+    set(mm "${result_minimal_header_${kernel}_0_ms}")
+    set(uk "${result_umbrella_header_${kernel}_0_kb}")
+    set(mk "${result_minimal_header_${kernel}_0_kb}")
+
+    set(ratio "")
+    if(NOT "${um}" STREQUAL "" AND NOT "${mm}" STREQUAL "" AND um GREATER 0)
+      math(EXPR ratio "(100 * ${mm}) / ${um}")
+      set(ratio "${ratio}%")
+    endif()
+
+    string(LENGTH "${kernel}" len)
+    math(EXPR fill "8 - ${len}")
+    string(REPEAT " " ${fill} spaces)
+    pad(um "${um}" 18)
+    pad(mm "${mm}" 13)
+    pad(uk "${uk}" 19)
+    pad(mk "${mk}" 15)
+    cell(ratio "${ratio}")
+    message("${kernel}${spaces}${um}${mm}${uk}${mk}${ratio}")
+  endforeach()
+
+  message("${rule}")
+endif()
+
+message("Raw results: ${KUMI_BENCH_CSV}")
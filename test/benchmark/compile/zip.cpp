@@ -0,0 +1,15 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "common.hpp"
+
+int main()
+{
+  auto t0 = bench::generate<bench::arity>();
+  auto t1 = bench::generate<bench::arity, bench::arity>();
+  return bench::observe(bench::zip(t0, t1));
+}
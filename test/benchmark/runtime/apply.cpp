@@ -0,0 +1,32 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  float sum = 0;
+
+  auto kumi = bench::measure( [&](std::size_t i)
+  {
+    sum += kumi::apply( [](float x, float y, float z, int id) { return x * y + z * id; }
+                      , data.tuples[i]
+                      );
+    bench::do_not_optimize(sum);
+  });
+
+  auto manual = bench::measure( [&](std::size_t i)
+  {
+    auto const& r = data.records[i];
+    sum += r.x * r.y + r.z * r.id;
+    bench::do_not_optimize(sum);
+  });
+
+  bench::header();
+  bench::report("apply", kumi, manual);
+}
@@ -0,0 +1,179 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#pragma once
+
+#include <kumi/tuple.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//==================================================================================================
+// Runtime micro-benchmark harness
+//
+// Each kernel is run over a batch of records both through kumi and through hand-written member
+// accesses on a plain struct. The fastest of several repetitions is kept and reported as ns/op
+// and, when hardware counters are available, instructions/op.
+//==================================================================================================
+namespace bench
+{
+  inline constexpr std::size_t size        = 1 << 16;
+  inline constexpr int         repetitions = 25;
+
+  struct record
+  {
+    float x, y, z;
+    int   id;
+
+    friend bool operator<(record const& a, record const& b)
+    {
+      if(a.x != b.x) return a.x < b.x;
+      if(a.y != b.y) return a.y < b.y;
+      if(a.z != b.z) return a.z < b.z;
+      return a.id < b.id;
+    }
+  };
+
+  using tuple = kumi::tuple<float, float, float, int>;
+
+  template<typename T> inline void do_not_optimize(T const& v)
+  {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(v) : "memory");
+#else
+    static_cast<void>(*static_cast<T const volatile*>(&v));
+#endif
+  }
+
+  //================================================================================================
+  // Hardware instruction counter - reports nothing if unavailable
+  //================================================================================================
+  struct counter
+  {
+#if defined(__linux__)
+    int fd = -1;
+
+    counter()
+    {
+      perf_event_attr attr = {};
+      attr.type           = PERF_TYPE_HARDWARE;
+      attr.size           = sizeof(attr);
+      attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    ~counter() { if(fd >= 0) close(fd); }
+
+    bool valid() const { return fd >= 0; }
+    void start()       { if(valid()) { ioctl(fd, PERF_EVENT_IOC_RESET, 0); ioctl(fd, PERF_EVENT_IOC_ENABLE, 0); } }
+
+    std::uint64_t stop()
+    {
+      std::uint64_t value = 0;
+      if(valid())
+      {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if(read(fd, &value, sizeof(value)) != sizeof(value)) value = 0;
+      }
+      return value;
+    }
+#else
+    bool          valid() const { return false; }
+    void          start()       {}
+    std::uint64_t stop()        { return 0; }
+#endif
+  };
+
+  struct result
+  {
+    double ns;
+    double instructions;
+  };
+
+  //================================================================================================
+  // Runs kernel(i) for every i in [0, size) and returns the best per-operation cost
+  //================================================================================================
+  template<typename Kernel> result measure(Kernel kernel)
+  {
+    counter hw;
+    result  best = {1e300, 1e300};
+
+    for(int r = 0; r < repetitions; ++r)
+    {
+      auto start = std::chrono::steady_clock::now();
+      hw.start();
+      for(std::size_t i = 0; i < size; ++i) kernel(i);
+      auto instructions = hw.stop();
+      auto stop = std::chrono::steady_clock::now();
+
+      double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+      best.ns           = std::min(best.ns, ns / size);
+      best.instructions = std::min(best.instructions, double(instructions) / size);
+    }
+
+    if(!hw.valid()) best.instructions = -1;
+    return best;
+  }
+
+  inline void header()
+  {
+    std::printf ( "%-16s %12s %12s %12s %12s %8s\n"
+                , "kernel", "kumi ns/op", "manual ns/op", "kumi ins/op", "manual ins/op", "ratio"
+                );
+  }
+
+  inline void report(char const* name, result kumi, result manual)
+  {
+    auto ins = [](double v, char* buffer)
+    {
+      if(v < 0) std::snprintf(buffer, 16, "n/a");
+      else      std::snprintf(buffer, 16, "%.2f", v);
+      return buffer;
+    };
+
+    char ki[16], mi[16];
+    std::printf ( "%-16s %12.3f %12.3f %12s %12s %7.2fx\n"
+                , name, kumi.ns, manual.ns, ins(kumi.instructions, ki)
+                , ins(manual.instructions, mi), kumi.ns / manual.ns
+                );
+  }
+
+  //================================================================================================
+  // Identical pseudo-random data laid out as kumi::tuple and as a plain struct
+  //================================================================================================
+  struct dataset
+  {
+    std::vector<tuple>  tuples;
+    std::vector<record> records;
+
+    dataset() : tuples(size + 1), records(size + 1)
+    {
+      std::uint32_t seed = 0x9E3779B9u;
+      auto next = [&]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+
+      for(std::size_t i = 0; i <= size; ++i)
+      {
+        float x = float(next() % 16), y = float(next() % 16), z = float(next() % 1000) / 7.f;
+        int   id = int(next() % 1000);
+        tuples[i]  = tuple{x, y, z, id};
+        records[i] = record{x, y, z, id};
+      }
+    }
+  };
+}
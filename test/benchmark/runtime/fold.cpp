@@ -0,0 +1,46 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  double sum = 0;
+
+  auto plus = [](auto a, auto b) { return a + b; };
+
+  auto left = bench::measure( [&](std::size_t i)
+  {
+    sum += kumi::fold_left(plus, data.tuples[i], 0.);
+    bench::do_not_optimize(sum);
+  });
+
+  auto right = bench::measure( [&](std::size_t i)
+  {
+    sum += kumi::fold_right(plus, data.tuples[i], 0.);
+    bench::do_not_optimize(sum);
+  });
+
+  auto manual_left = bench::measure( [&](std::size_t i)
+  {
+    auto const& r = data.records[i];
+    sum += (((0. + r.x) + r.y) + r.z) + r.id;
+    bench::do_not_optimize(sum);
+  });
+
+  auto manual_right = bench::measure( [&](std::size_t i)
+  {
+    auto const& r = data.records[i];
+    sum += r.x + (r.y + (r.z + (r.id + 0.)));
+    bench::do_not_optimize(sum);
+  });
+
+  bench::header();
+  bench::report("fold_left" , left  , manual_left );
+  bench::report("fold_right", right , manual_right);
+}
@@ -0,0 +1,30 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  float sum = 0;
+
+  auto kumi = bench::measure( [&](std::size_t i)
+  {
+    kumi::for_each([&](auto v) { sum += v; }, data.tuples[i]);
+    bench::do_not_optimize(sum);
+  });
+
+  auto manual = bench::measure( [&](std::size_t i)
+  {
+    auto const& r = data.records[i];
+    sum += r.x; sum += r.y; sum += r.z; sum += r.id;
+    bench::do_not_optimize(sum);
+  });
+
+  bench::header();
+  bench::report("for_each", kumi, manual);
+}
@@ -0,0 +1,29 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  std::size_t count = 0;
+
+  auto kumi = bench::measure( [&](std::size_t i)
+  {
+    count += data.tuples[i] < data.tuples[i+1];
+    bench::do_not_optimize(count);
+  });
+
+  auto manual = bench::measure( [&](std::size_t i)
+  {
+    count += data.records[i] < data.records[i+1];
+    bench::do_not_optimize(count);
+  });
+
+  bench::header();
+  bench::report("operator<", kumi, manual);
+}
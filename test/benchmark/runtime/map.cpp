@@ -0,0 +1,31 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  std::vector<bench::tuple>  tout(bench::size);
+  std::vector<bench::record> rout(bench::size);
+
+  auto kumi = bench::measure( [&](std::size_t i)
+  {
+    tout[i] = kumi::map([](auto v) { return v * 2; }, data.tuples[i]);
+    bench::do_not_optimize(tout[i]);
+  });
+
+  auto manual = bench::measure( [&](std::size_t i)
+  {
+    auto const& r = data.records[i];
+    rout[i] = bench::record{r.x * 2, r.y * 2, r.z * 2, r.id * 2};
+    bench::do_not_optimize(rout[i]);
+  });
+
+  bench::header();
+  bench::report("map", kumi, manual);
+}
@@ -0,0 +1,32 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include "bench.hpp"
+
+int main()
+{
+  bench::dataset data;
+  float sum = 0;
+
+  auto kumi = bench::measure( [&](std::size_t i)
+  {
+    auto z = kumi::zip(data.tuples[i], data.tuples[i+1]);
+    sum += kumi::fold_left( [](float acc, auto p) { return acc + get<0>(p) * get<1>(p); }, z, 0.f);
+    bench::do_not_optimize(sum);
+  });
+
+  auto manual = bench::measure( [&](std::size_t i)
+  {
+    auto const& a = data.records[i];
+    auto const& b = data.records[i+1];
+    sum += ((((0.f + a.x * b.x) + a.y * b.y) + a.z * b.z) + a.id * b.id);
+    bench::do_not_optimize(sum);
+  });
+
+  bench::header();
+  bench::report("zip", kumi, manual);
+}
@@ -0,0 +1,23 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/span.hpp>
+#include <algorithm>
+#include <iostream>
+
+int main()
+{
+  auto t = kumi::tuple{ 4.f, 1.f, 3.f, 2.f };
+
+  // No copy: sorting the span sorts the tuple
+  auto s = kumi::as_span(t);
+  std::sort(s.begin(), s.end());
+  std::cout << t << "\n";
+
+  for(auto v : kumi::as_array(kumi::iota<4>(10))) std::cout << v << " ";
+  std::cout << "\n";
+}
@@ -0,0 +1,21 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+
+int main()
+{
+  kumi::tuple         t = { 'a', 2.5, 'b', 42 };
+  kumi::compact_tuple c = { 'a', 2.5, 'b', 42 };
+
+  std::cout << sizeof(t) << " " << t << "\n";
+  std::cout << sizeof(c) << " " << c << "\n";
+
+  auto[a,b,x,i] = c;
+  std::cout << a << " " << b << " " << x << " " << i << "\n";
+}
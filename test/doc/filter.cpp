@@ -0,0 +1,22 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+int main()
+{
+  auto record = kumi::tuple{ 1, std::string{"name"}, 2.5, std::string{"label"}, 'z' };
+
+  std::cout << kumi::filter<std::is_arithmetic>(record) << "\n";
+
+  auto [trivial, owning] = kumi::partition<std::is_trivially_copyable>(std::move(record));
+  std::cout << trivial << "\n";
+  std::cout << owning  << "\n";
+}
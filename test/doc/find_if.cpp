@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+#include <type_traits>
+
+int main()
+{
+  auto t = kumi::tuple{1, 2., 0ULL, 3.f, 'z'};
+
+  std::cout << kumi::find_if( t, kumi::predicate<std::is_floating_point>() ) << "\n";
+
+  // The predicate is not called on elements following the first match
+  std::cout << kumi::find_if( t, [](auto e) { std::cout << e << " "; return e > 2; } ) << "\n";
+}
@@ -0,0 +1,23 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/views.hpp>
+#include <iostream>
+
+int main()
+{
+  auto types  = kumi::tuple{ 1, 2.5f };
+  auto values = kumi::tuple{ 'a', 3.1415 };
+
+  // Only the accessed combination is computed
+  auto grid = kumi::views::cartesian_product(types, values);
+  std::cout << kumi::size<decltype(grid)>::value << " " << get<3>(grid) << "\n";
+
+  kumi::for_each_combination( [](auto a, auto b) { std::cout << a << " " << b << "\n"; }
+                            , types, values
+                            );
+}
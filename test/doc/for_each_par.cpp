@@ -0,0 +1,22 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/execution.hpp>
+#include <iostream>
+
+int main()
+{
+  auto t = kumi::tuple{ 1, 2.3, 0.43f };
+
+  // Each element may be processed on a different thread
+  kumi::for_each( kumi::par
+                , [](auto& m) { m *= 10.f; }
+                , t
+                );
+
+  std::cout << t << "\n";
+}
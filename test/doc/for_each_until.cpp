@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+
+int main()
+{
+  auto t = kumi::tuple{ 1, 2.3, -0.43f, 8 };
+
+  auto stopped = kumi::for_each_until ( [](auto& m) { m *= 10; return m < 0; }
+                                      , t
+                                      );
+
+  std::cout << t << " stopped at " << stopped << "\n";
+}
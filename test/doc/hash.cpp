@@ -0,0 +1,30 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/hash.hpp>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+int main()
+{
+  using key_t = kumi::tuple<std::string, int>;
+  std::unordered_map<key_t, double, kumi::transparent_hash, kumi::transparent_equal> constants;
+
+  constants[{"pi", 1}] = 3.14159;
+  constants[{"e" , 2}] = 2.71828;
+
+  // Look up using string_view without building a std::string
+  std::string_view name = "pi";
+  int              rank = 1;
+
+  if(auto it = constants.find(kumi::tie(name, rank)); it != constants.end())
+    std::cout << it->first << " : " << it->second << "\n";
+
+  std::cout << (kumi::hash(kumi::tuple{1, 2, 3}) == kumi::hash(kumi::tuple{1, 2, 3})) << "\n";
+}
@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/execution.hpp>
+#include <iostream>
+
+int main()
+{
+  auto lhs = kumi::tuple{1,2,3};
+  auto rhs = kumi::tuple{2.5,3.6,4.7};
+
+  // Use at most two threads to compute each product
+  auto r = kumi::map( kumi::par(2), [](auto l, auto r) { return l*r; }, lhs, rhs);
+
+  std::cout << r << "\n";
+}
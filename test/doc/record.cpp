@@ -0,0 +1,30 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/record.hpp>
+#include <iostream>
+#include <string>
+
+using order = kumi::record< kumi::field<"price", double>
+                          , kumi::field<"qty"  , int>
+                          , kumi::field<"sym"  , std::string>
+                          >;
+
+int main()
+{
+  using namespace kumi::literals;
+
+  order o = { 12.5, 3, "ABC" };
+
+  // Names are resolved at compile time
+  o["qty"_f] += 1;
+  std::cout << get<"price">(o) * get<"qty">(o) << "\n";
+
+  // kumi::record is a kumi::product_type
+  std::cout << kumi::to_tuple(o) << "\n";
+  std::cout << o << "\n";
+}
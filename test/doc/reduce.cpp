@@ -0,0 +1,24 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+#include <string>
+
+int main()
+{
+  auto t = kumi::generate<8>(0.1f);
+
+  // Evaluated as ((a+b)+(c+d))+((e+f)+(g+h))
+  std::cout << kumi::reduce([](auto a, auto b) { return a + b; }, t, 0.f) << "\n";
+
+  auto s = kumi::tuple{"a", "b", "c", "d", "e"};
+  auto shape = [](auto a, auto b) { return "(" + std::string(a) + " " + std::string(b) + ")"; };
+
+  std::cout << kumi::reduce(shape, s, "")    << "\n";
+  std::cout << kumi::reduce<3>(shape, s, "") << "\n";
+}
@@ -0,0 +1,20 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/serialize.hpp>
+#include <iostream>
+#include <string>
+
+int main()
+{
+  auto t = kumi::tuple{ 1, 2.3, kumi::tuple{ std::string("text"), 'z' } };
+
+  auto bytes = kumi::serialize(t);
+  std::cout << bytes.size() << " bytes\n";
+
+  if(auto r = kumi::deserialize<decltype(t)>(bytes)) std::cout << *r << "\n";
+}
@@ -0,0 +1,31 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/soa_vector.hpp>
+#include <iostream>
+
+int main()
+{
+  kumi::soa_vector<float, float, int> points;
+
+  for(int i = 0; i < 4; ++i) points.emplace_back(1.5f * i, -1.f * i, i);
+
+  // Row-wise access through a tuple of references
+  get<2>(points[1]) = 42;
+  std::cout << points[1] << "\n";
+
+  // Column-wise access
+  for(auto& x : points.column<0>()) x *= 2;
+
+  kumi::for_each( [](auto column)
+                  {
+                    for(auto e : column) std::cout << e << " ";
+                    std::cout << "\n";
+                  }
+                , points.columns()
+                );
+}
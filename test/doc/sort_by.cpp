@@ -0,0 +1,19 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+#include <type_traits>
+
+template<typename T> struct size_of : std::integral_constant<std::size_t, sizeof(T)> {};
+
+int main()
+{
+  auto t = kumi::tuple{ 1., 'c', 2, short{3}, 'd' };
+
+  std::cout << kumi::sort_by<size_of>(t) << "\n";
+}
@@ -0,0 +1,32 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/views.hpp>
+#include <iostream>
+#include <string>
+
+int main()
+{
+  auto names  = kumi::tuple{ std::string("x"), std::string("y"), std::string("z") };
+  auto values = kumi::tuple{ 1, 2.5, 'c' };
+
+  // No string is copied while building and traversing the views
+  auto pairs    = kumi::views::zip(names, values);
+  auto reversed = kumi::views::reorder<2,1,0>(pairs);
+
+  kumi::for_each( [](auto const& p) { std::cout << get<0>(p) << " = " << get<1>(p) << "\n"; }
+                , reversed
+                );
+
+  // Modifying the view modifies the original tuple
+  get<0>(kumi::views::cat(values, names)) = 42;
+  std::cout << values << "\n";
+
+  // Elements are copied into a kumi::tuple only when requested
+  auto columns = kumi::to_tuple(kumi::views::transpose(reversed));
+  std::cout << columns << "\n";
+}
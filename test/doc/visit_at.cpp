@@ -0,0 +1,25 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+
+int main()
+{
+  auto t = kumi::tuple{1, 2., 3.f, 'z'};
+
+  // Runtime index, e.g. coming from a message
+  std::size_t column = 2;
+
+  kumi::visit_at(t, column, [](auto e) { std::cout << e << "\n"; });
+
+  // Combined with kumi::locate
+  auto i = kumi::locate(t, [](auto e) { return e > 2; });
+  if(i < kumi::size_v<decltype(t)>) kumi::visit_at(t, i, [](auto& e) { e += 10; });
+
+  std::cout << t << "\n";
+}
@@ -0,0 +1,33 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/lookup.hpp>
+#include <iostream>
+#include <string>
+
+using config = kumi::record< kumi::field<"threads", int>
+                           , kumi::field<"ratio"  , double>
+                           , kumi::field<"name"   , std::string>
+                           >;
+
+int main()
+{
+  config c = { 1, 0.5, "default" };
+
+  // Names coming from a configuration file
+  for(std::string key : { "ratio", "threads", "verbose" })
+  {
+    bool found = kumi::visit_field(c, key, [](auto& v) { std::cout << v << "\n"; });
+    if(!found) std::cout << key << " is not a field\n";
+  }
+
+  // Any kumi::product_type can be looked up given the names of its elements
+  auto t = kumi::tuple{ 'x', 42 };
+  kumi::visit_field<"letter","answer">(t, "answer", [](auto v) { std::cout << v << "\n"; });
+
+  std::cout << kumi::name_index<"a","b","c">::find("c") << "\n";
+}
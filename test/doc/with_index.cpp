@@ -0,0 +1,22 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#include <kumi/tuple.hpp>
+#include <iostream>
+
+int main()
+{
+  auto t = kumi::tuple{1, 2., 3.f, 'z'};
+
+  for(std::size_t i = 0; i < kumi::size_v<decltype(t)>; ++i)
+  {
+    kumi::with_index<kumi::size_v<decltype(t)>>
+    ( i
+    , [&](auto n) { std::cout << n << " -> " << t[n] << "\n"; }
+    );
+  }
+}
@@ -14,26 +14,43 @@ generate_test("unit/apply.cpp"             )
 generate_test("unit/as_flat_ptr.cpp"       )
 generate_test("unit/cartesian_product.cpp" )
 generate_test("unit/cat.cpp"               )
+generate_test("unit/compare.cpp"           )
+generate_test("unit/compact_tuple.cpp"     )
 generate_test("unit/concepts.cpp"          )
 generate_test("unit/convert.cpp"           )
+generate_test("unit/core.cpp"              )
+generate_test("unit/execution.cpp"         )
 generate_test("unit/extract.cpp"           )
+generate_test("unit/filter.cpp"            )
+generate_test("unit/find_if.cpp"           )
 generate_test("unit/flatten.cpp"           )
 generate_test("unit/fold.cpp"              )
 generate_test("unit/for_each.cpp"          )
 generate_test("unit/forward_as_tuple.cpp"  )
 generate_test("unit/generate.cpp"          )
+generate_test("unit/hash.cpp"              )
 generate_test("unit/iota.cpp"              )
 generate_test("unit/locate.cpp"            )
+generate_test("unit/lookup.cpp"            )
 generate_test("unit/make_tuple.cpp"        )
 generate_test("unit/map.cpp"               )
 generate_test("unit/map_index.cpp"         )
 generate_test("unit/max.cpp"               )
 generate_test("unit/min.cpp"               )
+generate_test("unit/move.cpp"              )
 generate_test("unit/predicates.cpp"        )
 generate_test("unit/push_pop.cpp"          )
+generate_test("unit/record.cpp"            )
+generate_test("unit/reduce.cpp"            )
+generate_test("unit/result.cpp"            )
 generate_test("unit/reorder.cpp"           )
+generate_test("unit/serialize.cpp"         )
+generate_test("unit/soa_vector.cpp"        )
+generate_test("unit/span.cpp"              )
 generate_test("unit/split.cpp"             )
 generate_test("unit/tie.cpp"               )
 generate_test("unit/transpose.cpp"         )
+generate_test("unit/views.cpp"             )
+generate_test("unit/visit_at.cpp"          )
 generate_test("unit/zip.cpp"               )
 generate_test("unit/to_ref.cpp"            )
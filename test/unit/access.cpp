@@ -66,3 +66,21 @@ TTS_CASE("Check constexpr access to kumi::tuple via indexing")
   TTS_CONSTEXPR_EQUAL(get<2>(t4), t4[2_c]);
   TTS_CONSTEXPR_EQUAL(get<3>(t4), t4[3_c]);
 };
+
+TTS_CASE("Check access to element types of large kumi::tuple")
+{
+  using small_t = kumi::tuple<char, short, int, long, float, double, void*, char const*>;
+  using large_t = kumi::result::cat_t<small_t, small_t, small_t, small_t, small_t, small_t, small_t
+                                     , small_t, small_t, small_t, small_t, small_t, small_t, small_t
+                                     , small_t, small_t, small_t, small_t, small_t, small_t, small_t
+                                     , small_t, small_t, small_t, small_t
+                                     >;
+
+  TTS_CONSTEXPR_EQUAL(kumi::size_v<large_t>, 200ULL);
+  TTS_TYPE_IS((kumi::element_t<0  , large_t>), char);
+  TTS_TYPE_IS((kumi::element_t<73 , large_t>), short);
+  TTS_TYPE_IS((kumi::element_t<130, large_t>), int);
+  TTS_TYPE_IS((kumi::element_t<199, large_t>), char const*);
+  TTS_TYPE_IS((kumi::element_t<199, large_t const>), char const* const);
+  TTS_TYPE_IS((kumi::member_t<100, large_t&>), float&);
+};
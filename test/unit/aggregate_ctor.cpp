@@ -8,6 +8,7 @@
 #define TTS_MAIN
 #include <kumi/tuple.hpp>
 #include <tts/tts.hpp>
+#include <cstring>
 
 TTS_CASE("Check tuple_element of kumi::tuple")
 {
@@ -84,3 +85,48 @@ TTS_CASE("Check construction of kumi::tuple as a constexpr aggregate")
   TTS_CONSTEXPR_EQUAL(get<2>(t4), 3.f);
   TTS_CONSTEXPR_EQUAL(get<3>(t4), 4);
 };
+
+struct empty_a {};
+struct empty_b {};
+struct policy  { constexpr int operator()(int x) const { return x + 1; } };
+
+TTS_CASE("Check empty members of kumi::tuple take no space")
+{
+  TTS_CONSTEXPR_EQUAL( sizeof(kumi::tuple<empty_a, int>)              , sizeof(int) );
+  TTS_CONSTEXPR_EQUAL( sizeof(kumi::tuple<int, empty_a, empty_b>)     , sizeof(int) );
+  TTS_CONSTEXPR_EQUAL( sizeof(kumi::tuple<empty_a, double, policy>)   , sizeof(double));
+  TTS_CONSTEXPR_EQUAL( sizeof(kumi::tuple<empty_a, empty_b, policy>)  , 1ULL        );
+  TTS_CONSTEXPR_EQUAL( (sizeof(kumi::tuple<kumi::tuple<empty_a, policy>, int>)), sizeof(int));
+  TTS_CONSTEXPR_EXPECT( (std::is_empty_v<kumi::tuple<empty_a, policy>>) );
+};
+
+struct non_pod
+{
+  non_pod() = default;
+  non_pod(int i, char c) : i(i), c(c) {}
+
+  int   i = 0;
+  char  c = 0;
+};
+
+TTS_CASE("Check non-empty members of kumi::tuple keep their tail padding")
+{
+  struct pod_layout     { struct { int i; char c; } a; char b; };
+  struct non_pod_layout { non_pod a; char b; };
+
+  TTS_CONSTEXPR_EQUAL( (sizeof(kumi::tuple<kumi::tuple<int,char>,char>)), sizeof(pod_layout)    );
+  TTS_CONSTEXPR_EQUAL( (sizeof(kumi::tuple<non_pod,char>))              , sizeof(non_pod_layout));
+
+  kumi::tuple<non_pod, char> t{non_pod{}, 'z'};
+  non_pod s{1, 'a'};
+  std::memcpy(&get<0>(t), &s, sizeof(non_pod));
+  TTS_EQUAL(get<1>(t), 'z');
+};
+
+TTS_CASE("Check construction of kumi::tuple with empty members as a constexpr aggregate")
+{
+  constexpr auto t = kumi::tuple{empty_a{}, 41, policy{}};
+
+  TTS_CONSTEXPR_EXPECT((kumi::sized_product_type<decltype(t), 3>));
+  TTS_CONSTEXPR_EQUAL(get<2>(t)(get<1>(t)), 42);
+};
@@ -0,0 +1,91 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <string>
+
+TTS_CASE("Check kumi::compact_tuple storage size")
+{
+  using padded_t  = kumi::tuple<char, double, char, int>;
+  using compact_t = kumi::compact_tuple<char, double, char, int>;
+
+  TTS_CONSTEXPR_EXPECT( sizeof(compact_t) < sizeof(padded_t) );
+  TTS_CONSTEXPR_EQUAL ( sizeof(compact_t), 2*sizeof(double)   );
+  TTS_CONSTEXPR_EQUAL ( sizeof(kumi::compact_tuple<>), sizeof(kumi::tuple<>) );
+};
+
+TTS_CASE("Check kumi::compact_tuple keeps its declaration order")
+{
+  using compact_t = kumi::compact_tuple<char, double, char, int>;
+
+  TTS_CONSTEXPR_EXPECT( kumi::product_type<compact_t> );
+  TTS_CONSTEXPR_EQUAL ( kumi::size_v<compact_t>, 4ULL );
+  TTS_TYPE_IS( (kumi::element_t<0,compact_t>), char   );
+  TTS_TYPE_IS( (kumi::element_t<1,compact_t>), double );
+  TTS_TYPE_IS( (kumi::element_t<2,compact_t>), char   );
+  TTS_TYPE_IS( (kumi::element_t<3,compact_t>), int    );
+
+  compact_t t{'a', 2.5, 'b', 4};
+
+  TTS_EQUAL(get<0>(t), 'a');
+  TTS_EQUAL(get<1>(t), 2.5);
+  TTS_EQUAL(get<2>(t), 'b');
+  TTS_EQUAL(get<3>(t), 4  );
+
+  using namespace kumi::literals;
+  t[1_c] = 1.25;
+  TTS_EQUAL(t[1_c], 1.25);
+
+  auto [a, b, c, d] = t;
+  TTS_EQUAL(a, 'a');
+  TTS_EQUAL(b, 1.25);
+  TTS_EQUAL(c, 'b');
+  TTS_EQUAL(d, 4  );
+};
+
+TTS_CASE("Check kumi::compact_tuple with algorithms")
+{
+  kumi::compact_tuple t{'a', 2.5, short{3}, 4};
+
+  TTS_EQUAL(t, (kumi::tuple{'a', 2.5, short{3}, 4}) );
+  TTS_EQUAL(kumi::to_tuple(t), (kumi::tuple{'a', 2.5, short{3}, 4}) );
+  TTS_EQUAL(kumi::map([](auto e) { return e + 1; }, t), (kumi::tuple{'b', 3.5, 4, 5}) );
+  TTS_EQUAL(kumi::fold_left([](auto a, auto e) { return a + e; }, t, 0.), 106.5 );
+  TTS_EQUAL(kumi::push_back(t, 9), (kumi::tuple{'a', 2.5, short{3}, 4, 9}) );
+  TTS_EQUAL(kumi::pop_front(t), (kumi::tuple{2.5, short{3}, 4}) );
+  TTS_EQUAL(kumi::pop_back(t), (kumi::tuple{'a', 2.5, short{3}}) );
+  TTS_EQUAL(kumi::cat(t, kumi::tuple{1.f}), (kumi::tuple{'a', 2.5, short{3}, 4, 1.f}) );
+  TTS_EQUAL((kumi::reorder<3,0>(t)), (kumi::tuple{4, 'a'}) );
+
+  TTS_EXPECT( t < (kumi::compact_tuple{'a', 2.5, short{3}, 5}) );
+  TTS_EXPECT( (kumi::tuple{'a', 2.5, short{3}, 5}) > t );
+};
+
+TTS_CASE("Check kumi::compact_tuple with references and owning types")
+{
+  int         i = 0;
+  std::string s = "some long string that will not fit in SSO";
+
+  kumi::compact_tuple<char, int&, std::string> t{'z', i, std::move(s)};
+
+  get<1>(t) = 42;
+  TTS_EQUAL(i, 42);
+  TTS_EQUAL(get<2>(t), std::string{"some long string that will not fit in SSO"});
+  TTS_EQUAL(get<0>(t), 'z');
+};
+
+TTS_CASE("Check constexpr kumi::compact_tuple")
+{
+  constexpr kumi::compact_tuple t{'a', 2.5, 'b', 4};
+
+  TTS_CONSTEXPR_EQUAL(get<0>(t), 'a');
+  TTS_CONSTEXPR_EQUAL(get<1>(t), 2.5);
+  TTS_CONSTEXPR_EQUAL(get<2>(t), 'b');
+  TTS_CONSTEXPR_EQUAL(get<3>(t), 4  );
+};
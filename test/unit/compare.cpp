@@ -0,0 +1,104 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <compare>
+#include <limits>
+#include <string>
+
+struct no_cmp   { };
+struct less_only
+{
+  int v;
+  constexpr bool operator<(less_only const& o) const { return v < o.v; }
+};
+
+struct counted
+{
+  int  v;
+  int* calls;
+  auto operator<=>(counted const& o) const { ++*calls; return v <=> o.v; }
+  bool operator==(counted const& o) const { return v == o.v; }
+};
+
+TTS_CASE("Check ordering concepts for kumi::tuple")
+{
+  TTS_CONSTEXPR_EXPECT    ( (std::totally_ordered<kumi::tuple<int,double>>)               );
+  TTS_CONSTEXPR_EXPECT    ( (std::three_way_comparable<kumi::tuple<int,double>>)          );
+  TTS_CONSTEXPR_EXPECT    ( (std::three_way_comparable<kumi::tuple<int,kumi::tuple<char>>>));
+  TTS_CONSTEXPR_EXPECT_NOT( (std::three_way_comparable<kumi::tuple<int,no_cmp>>)          );
+};
+
+TTS_CASE("Check operator<=> result category for kumi::tuple")
+{
+  kumi::tuple<int, char>            s{1, 'a'};
+  kumi::tuple<int, double>          p{1, 2.};
+  kumi::tuple<int, less_only>       w{1, {2}};
+
+  TTS_TYPE_IS( decltype(s <=> s), std::strong_ordering  );
+  TTS_TYPE_IS( decltype(p <=> p), std::partial_ordering );
+  TTS_TYPE_IS( decltype(w <=> w), std::weak_ordering    );
+  TTS_TYPE_IS( decltype(kumi::tuple{} <=> kumi::tuple{}), std::strong_ordering );
+};
+
+TTS_CASE("Check lexicographical comparisons of kumi::tuple")
+{
+  kumi::tuple a{1, 2.5, std::string{"abc"}};
+  kumi::tuple b{1, 2.5, std::string{"abd"}};
+  kumi::tuple c{0, 9.5, std::string{"zzz"}};
+
+  TTS_EXPECT( (a <=> b) < 0   );
+  TTS_EXPECT( (a <=> a) == 0  );
+  TTS_EXPECT( (b <=> c) > 0   );
+
+  TTS_EXPECT    ( a <  b );
+  TTS_EXPECT_NOT( b <  a );
+  TTS_EXPECT_NOT( a <  a );
+  TTS_EXPECT    ( a <= a );
+  TTS_EXPECT    ( a <= b );
+  TTS_EXPECT    ( b >  c );
+  TTS_EXPECT    ( b >= b );
+  TTS_EXPECT_NOT( c >= a );
+
+  kumi::tuple<int,less_only> x{1, {2}}, y{1, {3}};
+  TTS_EXPECT    ( x <  y );
+  TTS_EXPECT_NOT( y <= x );
+
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  kumi::tuple n{1, nan};
+  TTS_EXPECT( (n <=> n) == std::partial_ordering::unordered );
+  TTS_EXPECT_NOT( n <  n );
+  TTS_EXPECT_NOT( n >= n );
+};
+
+TTS_CASE("Check lexicographical comparisons of kumi::tuple stop at first difference")
+{
+  int calls = 0;
+  kumi::tuple a{counted{1,&calls}, counted{2,&calls}, counted{3,&calls}};
+  kumi::tuple b{counted{0,&calls}, counted{2,&calls}, counted{3,&calls}};
+
+  TTS_EXPECT( b < a );
+  TTS_EQUAL ( calls, 1 );
+
+  calls = 0;
+  TTS_EXPECT( a >= a );
+  TTS_EQUAL ( calls, 3 );
+};
+
+TTS_CASE("Check constexpr lexicographical comparisons of kumi::tuple")
+{
+  constexpr kumi::tuple a{1, 2.f, 'z'};
+  constexpr kumi::tuple b{1, 3.f, 'a'};
+
+  TTS_CONSTEXPR_EXPECT    ( a <  b );
+  TTS_CONSTEXPR_EXPECT    ( a <= b );
+  TTS_CONSTEXPR_EXPECT_NOT( a >  b );
+  TTS_CONSTEXPR_EXPECT_NOT( a >= b );
+  TTS_CONSTEXPR_EXPECT    ( (a <=> b) < 0 );
+};
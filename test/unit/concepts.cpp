@@ -78,6 +78,16 @@ TTS_CASE("Check sized_product_type_or_more for tuple")
   TTS_CONSTEXPR_EXPECT_NOT( (kumi::sized_product_type_or_more<kumi::tuple<strange,int, cmp>, 4>)        );
 };
 
+TTS_CASE("Check homogeneous_product_type for tuple")
+{
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::homogeneous_product_type<int>)                       );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::homogeneous_product_type<kumi::tuple<>>)             );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::homogeneous_product_type<kumi::tuple<cmp>>)          );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::homogeneous_product_type<kumi::tuple<int,int,int>>)  );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::homogeneous_product_type<kumi::tuple<int,float>>)    );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::homogeneous_product_type<kumi::tuple<int,int&>>)     );
+};
+
 /*
   template<typename T>
   concept product_type = std_tuple_compatible<T> && is_product_type<std::remove_cvref_t<T>>::value;
@@ -0,0 +1,35 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/core.hpp>
+#include <kumi/algorithm/cat.hpp>
+#include <tts/tts.hpp>
+
+TTS_CASE("Check kumi::tuple is usable from kumi/core.hpp alone")
+{
+  kumi::tuple t{1, 2.5, 'z'};
+  auto [a, b, c] = t;
+
+  TTS_EQUAL(a, 1);
+  TTS_EQUAL(b, 2.5);
+  TTS_EQUAL(c, 'z');
+  TTS_EQUAL(kumi::get<1>(t), 2.5);
+  TTS_EQUAL(kumi::size<decltype(t)>::value, 3ULL);
+  TTS_EQUAL(kumi::apply([](auto... m) { return (0. + ... + m); }, t), 1 + 2.5 + 'z');
+  TTS_EXPECT(t == kumi::make_tuple(1, 2.5, 'z'));
+  TTS_EXPECT((t < kumi::tuple{1, 3.5, 'a'}));
+  TTS_TYPE_IS((kumi::result::apply_t<long(*)(int, double, char), decltype(t)>), long);
+};
+
+TTS_CASE("Check an algorithm is usable from its own header")
+{
+  auto t = kumi::cat(kumi::tuple{1, 2.5}, kumi::tuple{'z'});
+
+  TTS_TYPE_IS(decltype(t), (kumi::tuple<int, double, char>));
+  TTS_EQUAL(kumi::get<2>(t), 'z');
+};
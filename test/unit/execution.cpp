@@ -0,0 +1,108 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/execution.hpp>
+#include <tts/tts.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+TTS_CASE("Check for_each with execution policies behavior")
+{
+  auto t = kumi::tuple {1, 2., 3.4f, '5'};
+  kumi::for_each(kumi::seq, [](auto &m) { m++; }, t);
+
+  TTS_EQUAL(get<0>(t), 2);
+  TTS_EQUAL(get<1>(t), 3.);
+  TTS_EQUAL(get<2>(t), 4.4f);
+  TTS_EQUAL(get<3>(t), '6');
+
+  kumi::for_each(kumi::par, [](auto &m, auto n) { m *= n; }, t, t);
+
+  TTS_EQUAL(get<0>(t), 4);
+  TTS_EQUAL(get<1>(t), 9.);
+  TTS_EQUAL(get<2>(t), 19.36f);
+  TTS_EQUAL(get<3>(t), 'd');
+
+  bool was_run = false;
+  kumi::for_each(kumi::par, [&]() { was_run = true; }, kumi::tuple{});
+  TTS_EXPECT_NOT(was_run);
+};
+
+TTS_CASE("Check for_each with kumi::par runs concurrently")
+{
+  std::atomic<int> waiting = 0;
+  auto rendezvous = [&](auto)
+  {
+    ++waiting;
+    while(waiting.load() < 2) std::this_thread::yield();
+  };
+
+  // Would never complete if both elements were processed sequentially
+  kumi::for_each(kumi::par(2), rendezvous, kumi::tuple{1,2});
+  TTS_EQUAL(waiting.load(), 2);
+
+  std::mutex guard;
+  std::set<std::thread::id> ids;
+  auto t = kumi::generate<16>(0);
+  kumi::for_each( kumi::par(4)
+                , [&](int& m)
+                  {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    std::lock_guard lock(guard);
+                    ids.insert(std::this_thread::get_id());
+                    m = 1;
+                  }
+                , t
+                );
+
+  TTS_EQUAL(kumi::count_if(t, [](int m) { return m == 1; }), 16ULL);
+  TTS_LESS_EQUAL(ids.size(), 4ULL);
+};
+
+TTS_CASE("Check map with execution policies behavior")
+{
+  auto t = kumi::tuple {1, 2., 3.4f, '5'};
+
+  TTS_EQUAL ( kumi::map(kumi::seq, [](auto m) { return m + 1; }, t)
+            , kumi::map([](auto m) { return m + 1; }, t)
+            );
+
+  auto mul = [](auto m, auto n) { return m * n; };
+  auto r    = kumi::map(kumi::par, mul, t, t);
+  TTS_EQUAL(r, kumi::map(mul, t, t));
+  TTS_TYPE_IS(decltype(r), decltype(kumi::map(mul, t, t)));
+
+  auto s = kumi::map( kumi::par
+                    , [](auto m) { return std::to_string(m); }
+                    , kumi::tuple{1, 2U, 3L}
+                    );
+  TTS_EQUAL(s, (kumi::tuple<std::string,std::string,std::string>{"1","2","3"}));
+
+  auto u = kumi::map( kumi::par
+                    , [](auto&& p) { return *p; }
+                    , kumi::make_tuple(std::make_unique<int>(4), std::make_unique<double>(2.5))
+                    );
+  TTS_EQUAL(u, (kumi::tuple{4, 2.5}));
+
+  TTS_EQUAL(kumi::map(kumi::par, [](auto m) { return m; }, kumi::tuple{}), kumi::tuple{});
+};
+
+TTS_CASE("Check for_each and map with kumi::par propagate exceptions")
+{
+  auto t = kumi::tuple{1, 2, 3, 4};
+  auto f = [](int m) { if(m == 3) throw std::runtime_error("3"); return m; };
+
+  TTS_THROW(kumi::for_each(kumi::par, f, t), std::runtime_error);
+  TTS_THROW(kumi::map(kumi::par, f, t), std::runtime_error);
+};
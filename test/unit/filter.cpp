@@ -0,0 +1,99 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+template<typename T> struct size_of : std::integral_constant<std::size_t, sizeof(T)> {};
+template<typename T> struct rank_of : std::integral_constant<int, -static_cast<int>(sizeof(T))> {};
+
+TTS_CASE("Check result::filter/partition/sort_by<Tuple> behavior")
+{
+  using tuple_t = kumi::tuple<char, std::string, double, short, std::string>;
+
+  TTS_TYPE_IS ( (kumi::result::filter_t<std::is_trivially_copyable, tuple_t>)
+              , (kumi::tuple<char, double, short>)
+              );
+
+  TTS_TYPE_IS ( (kumi::result::partition_t<std::is_trivially_copyable, tuple_t>)
+              , (kumi::tuple< kumi::tuple<char, double, short>
+                            , kumi::tuple<std::string, std::string>
+                            >)
+              );
+
+  TTS_TYPE_IS ( (kumi::result::sort_by_t<size_of, kumi::tuple<double, char, int, short, char>>)
+              , (kumi::tuple<char, char, short, int, double>)
+              );
+
+  TTS_TYPE_IS ( (kumi::result::sort_by_t<rank_of, kumi::tuple<char, double, short, int>>)
+              , (kumi::tuple<double, int, short, char>)
+              );
+
+  TTS_TYPE_IS ( (kumi::result::filter_t<std::is_integral, kumi::tuple<>>), kumi::tuple<> );
+  TTS_TYPE_IS ( (kumi::result::sort_by_t<size_of, kumi::tuple<>>)        , kumi::tuple<> );
+};
+
+TTS_CASE("Check filter/partition/sort_by behavior")
+{
+  auto t = kumi::tuple{1, std::string{"a"}, 2.5, 'z', std::string{"b"}};
+
+  TTS_EQUAL( kumi::filter<std::is_arithmetic>(t), (kumi::tuple{1, 2.5, 'z'}) );
+  TTS_EQUAL( kumi::filter<std::is_pointer>(t)   , kumi::tuple{} );
+
+  auto [trivial, owning] = kumi::partition<std::is_trivially_copyable>(t);
+  TTS_EQUAL( trivial, (kumi::tuple{1, 2.5, 'z'}) );
+  TTS_EQUAL( owning , (kumi::tuple{std::string{"a"}, std::string{"b"}}) );
+
+  TTS_EQUAL( kumi::sort_by<size_of>(kumi::tuple{1., 'c', 2, short{3}})
+           , (kumi::tuple{'c', short{3}, 2, 1.})
+           );
+};
+
+TTS_CASE("Check filter/partition/sort_by move elements out of rvalues")
+{
+  using ptr = std::unique_ptr<int>;
+
+  auto f = kumi::filter<std::is_class>(kumi::tuple{1, ptr{new int(2)}, 'c', ptr{new int(4)}});
+  TTS_TYPE_IS( decltype(f), (kumi::tuple<ptr,ptr>) );
+  TTS_EQUAL( *get<0>(f), 2 );
+  TTS_EQUAL( *get<1>(f), 4 );
+
+  auto t = kumi::tuple{ptr{new int(1)}, 2., ptr{new int(3)}};
+  auto [owning, trivial] = kumi::partition<std::is_class>(std::move(t));
+  TTS_EQUAL( *get<0>(owning), 1 );
+  TTS_EQUAL( *get<1>(owning), 3 );
+  TTS_EQUAL( get<0>(trivial), 2. );
+  TTS_EQUAL( get<0>(t), nullptr );
+
+  auto s = kumi::sort_by<rank_of>(kumi::tuple{'c', ptr{new int(5)}});
+  TTS_TYPE_IS( decltype(s), (kumi::tuple<ptr,char>) );
+  TTS_EQUAL( *get<0>(s), 5 );
+};
+
+TTS_CASE("Check filter/partition/sort_by keep reference elements")
+{
+  int i = 1;
+  double d = 2.5;
+  auto r = kumi::filter<std::is_lvalue_reference>(kumi::tuple<int&, char, double&>{i, 'c', d});
+
+  TTS_TYPE_IS( decltype(r), (kumi::tuple<int&, double&>) );
+  get<1>(r) = 4.5;
+  TTS_EQUAL( d, 4.5 );
+};
+
+TTS_CASE("Check filter/partition/sort_by constexpr behavior")
+{
+  constexpr auto t = kumi::tuple{1., 'c', 2, short{3}};
+
+  TTS_CONSTEXPR_EQUAL( kumi::filter<std::is_integral>(t), (kumi::tuple{'c', 2, short{3}}) );
+  TTS_CONSTEXPR_EQUAL( kumi::sort_by<size_of>(t)        , (kumi::tuple{'c', short{3}, 2, 1.}) );
+  TTS_CONSTEXPR_EQUAL( get<1>(kumi::partition<std::is_integral>(t)), kumi::tuple{1.} );
+};
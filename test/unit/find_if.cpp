@@ -0,0 +1,43 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <type_traits>
+
+TTS_CASE("Check kumi::find_if behavior")
+{
+  auto values = kumi::make_tuple(1, 2.5, -3.6f, 4ULL, -5);
+
+  TTS_EQUAL(kumi::find_if(values, [](auto e) { return e < 0; })        , 2ULL);
+  TTS_EQUAL(kumi::find_if(values, kumi::predicate<std::is_unsigned>()) , 3ULL);
+  TTS_EQUAL(kumi::find_if(values, [](auto e) { return e > 10; })       , 5ULL);
+  TTS_EQUAL(kumi::find_if(kumi::tuple{}, [](auto) { return true; })    , 0ULL);
+};
+
+TTS_CASE("Check kumi::find_if short-circuits")
+{
+  int calls = 0;
+  auto values = kumi::make_tuple(1, 2.5, -3.6f, 4ULL, -5);
+
+  TTS_EQUAL(kumi::find_if(values, [&](auto e) { ++calls; return e < 0; }), 2ULL);
+  TTS_EQUAL(calls, 3);
+
+  calls = 0;
+  TTS_EQUAL(kumi::find_if(values, [&](auto) { ++calls; return false; }), 5ULL);
+  TTS_EQUAL(calls, 5);
+};
+
+TTS_CASE("Check kumi::find_if constexpr behavior")
+{
+  TTS_CONSTEXPR_EQUAL ( kumi::find_if ( kumi::make_tuple(1, 2.5, -3.6f, 4ULL)
+                                      , [](auto e) { return e > 2; }
+                                      )
+                      , 1ULL
+                      );
+};
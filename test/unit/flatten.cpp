@@ -10,6 +10,7 @@
 #include <kumi/tuple.hpp>
 #include <tts/tts.hpp>
 #include <vector>
+#include <memory>
 
 TTS_CASE("Check result::flatten/flatten_all<Tuple> behavior")
 {
@@ -150,3 +151,43 @@ TTS_CASE("Check tuple::flatten_all + function constexpr behavior")
   TTS_CONSTEXPR_EQUAL(kumi::flatten_all(t2, inc),
                       (kumi::tuple {4.25f, 3., 2, short {56}, 4.25f, 3., 2, short {56}, 'b', 'b'}));
 };
+
+TTS_CASE("Check tuple::flatten_all on deeply nested and empty sub-tuples")
+{
+  auto t = kumi::tuple{ kumi::tuple{}, 1
+                      , kumi::tuple{ kumi::tuple{ kumi::tuple{2.5f, kumi::tuple{}} }, 'x' }
+                      , kumi::tuple{ kumi::tuple{ kumi::tuple{ kumi::tuple{3.} } } }
+                      };
+
+  auto f = kumi::flatten_all(t);
+  TTS_TYPE_IS( decltype(f), (kumi::tuple<int,float,char,double>) );
+  TTS_EQUAL( f, (kumi::tuple{1, 2.5f, 'x', 3.}) );
+
+  auto e = kumi::flatten_all(kumi::tuple{kumi::tuple{}, kumi::tuple{kumi::tuple{}}});
+  TTS_TYPE_IS( decltype(e), kumi::tuple<> );
+};
+
+TTS_CASE("Check tuple::flatten_all moves leaves out of rvalue trees")
+{
+  using ptr = std::unique_ptr<int>;
+  auto t = kumi::tuple{ ptr{new int(1)}, kumi::tuple{ ptr{new int(2)}, kumi::tuple{ptr{new int(3)}} } };
+
+  auto f = kumi::flatten_all(std::move(t));
+  TTS_TYPE_IS( decltype(f), (kumi::tuple<ptr,ptr,ptr>) );
+  TTS_EQUAL( *get<0>(f), 1 );
+  TTS_EQUAL( *get<1>(f), 2 );
+  TTS_EQUAL( *get<2>(f), 3 );
+};
+
+TTS_CASE("Check tuple::flatten_all + function visits leaves in order")
+{
+  int order = 0;
+  auto t = kumi::tuple{ 'a', kumi::tuple{ 'b', kumi::tuple{'c'} }, 'd' };
+
+  auto f = kumi::flatten_all(t, [&](char c) { return kumi::tuple{c, order++}; });
+  TTS_EQUAL( f, ( kumi::tuple { kumi::tuple{'a',0}, kumi::tuple{'b',1}
+                              , kumi::tuple{'c',2}, kumi::tuple{'d',3}
+                              }
+                )
+           );
+};
@@ -130,3 +130,40 @@ TTS_CASE("Check for_each_index constexpr behavior")
   kumi::for_each_index([&]() { was_run = true; }, kumi::tuple{});
   TTS_EXPECT_NOT(was_run);
 };
+
+TTS_CASE("Check for_each_until behavior")
+{
+  auto t = kumi::tuple {1, 2., 3.4f, '5'};
+  int calls = 0;
+
+  auto stopped = kumi::for_each_until([&](auto &m) { ++calls; m++; return m > 3; }, t);
+
+  TTS_EQUAL(stopped, 2ULL);
+  TTS_EQUAL(calls, 3);
+  TTS_EQUAL(get<0>(t), 2);
+  TTS_EQUAL(get<1>(t), 3.);
+  TTS_EQUAL(get<2>(t), 4.4f);
+  TTS_EQUAL(get<3>(t), '5');
+
+  stopped = kumi::for_each_until([](auto &m, auto n) { m += n; return false; }, t, t);
+
+  TTS_EQUAL(stopped, 4ULL);
+  TTS_EQUAL(get<0>(t), 4);
+  TTS_EQUAL(get<3>(t), 'j');
+
+  TTS_EQUAL(kumi::for_each_until([]() { return true; }, kumi::tuple{}), 0ULL);
+};
+
+TTS_CASE("Check for_each_until constexpr behavior")
+{
+  constexpr auto t = []() {
+    auto it = kumi::tuple {1, 2., 3.4f, '5'};
+    kumi::for_each_until([](auto &m) { m++; return m == 3; }, it);
+    return it;
+  }();
+
+  TTS_CONSTEXPR_EQUAL(get<0>(t), 2);
+  TTS_CONSTEXPR_EQUAL(get<1>(t), 3.);
+  TTS_CONSTEXPR_EQUAL(get<2>(t), 3.4f);
+  TTS_CONSTEXPR_EQUAL(get<3>(t), '5');
+};
@@ -0,0 +1,106 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/hash.hpp>
+#include <tts/tts.hpp>
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+struct no_hash {};
+enum class color : std::uint8_t { red, green, blue, alpha };
+
+TTS_CASE("Check kumi::hashable")
+{
+  TTS_CONSTEXPR_EXPECT    ( (kumi::hashable<kumi::tuple<>>)                                   );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::hashable<kumi::tuple<int,double,std::string>>)             );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::hashable<kumi::tuple<int&,kumi::tuple<std::string_view>>>) );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::hashable<int>)                                             );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::hashable<kumi::tuple<int,no_hash>>)                        );
+
+  TTS_CONSTEXPR_EXPECT    ( (std::is_default_constructible_v<std::hash<kumi::tuple<int,float>>>)    );
+  TTS_CONSTEXPR_EXPECT_NOT( (std::is_default_constructible_v<std::hash<kumi::tuple<int,no_hash>>>)  );
+};
+
+TTS_CASE("Check kumi::hash behavior")
+{
+  auto t = kumi::tuple{1, std::string("text"), kumi::tuple{2.5, 'z'}};
+
+  TTS_EQUAL(kumi::hash(t), kumi::hash(t));
+  TTS_EQUAL(kumi::hash(t), std::hash<decltype(t)>{}(t));
+  TTS_EQUAL(kumi::hash(kumi::tuple{}), kumi::hash(kumi::tuple{}));
+
+  // Values matter, including their order
+  TTS_NOT_EQUAL(kumi::hash(kumi::tuple{1, 2.5}), kumi::hash(kumi::tuple{1, 3.5}));
+  TTS_NOT_EQUAL(kumi::hash(kumi::tuple{1.5, 2.5}), kumi::hash(kumi::tuple{2.5, 1.5}));
+
+  // Tuples of references hash like the values they refer to
+  int         i = 1;
+  std::string s = "text";
+  double      d = 2.5;
+  char        c = 'z';
+  auto        r = kumi::tie(d,c);
+  TTS_EQUAL(kumi::hash(t), kumi::hash(kumi::tie(i, s, r)));
+};
+
+TTS_CASE("Check kumi::hash behavior on bytewise hashable tuples")
+{
+  auto t = kumi::tuple{1, 2U, std::int64_t{3}, std::int64_t{4}};
+
+  TTS_EQUAL(kumi::hash(t), std::hash<decltype(t)>{}(t));
+  TTS_EQUAL(kumi::hash(t), kumi::hash(kumi::tie(get<0>(t), get<1>(t), get<2>(t), get<3>(t))));
+  TTS_EQUAL(kumi::hash(kumi::tuple{'a', kumi::tuple{'b', color::blue}, 'c'})
+           , kumi::hash(kumi::tuple{'a', 'b', color::blue, 'c'})
+           );
+
+  // Every element contributes to the hash value
+  std::set<std::size_t> values;
+  for(int a = 0; a < 16; ++a)
+    for(int b = 0; b < 16; ++b)
+      for(auto e : {color::red, color::green, color::blue, color::alpha})
+        values.insert(kumi::hash(kumi::tuple{a, b, static_cast<char>(a + b), e, short{0}}));
+
+  TTS_EQUAL(values.size(), 16ULL * 16 * 4);
+};
+
+TTS_CASE("Check kumi::tuple in unordered containers")
+{
+  std::unordered_set<kumi::tuple<int,int>> grid;
+  for(int x = 0; x < 64; ++x)
+    for(int y = 0; y < 64; ++y)
+      grid.insert({x, y});
+
+  TTS_EQUAL(grid.size(), 64ULL * 64);
+  TTS_EXPECT(grid.contains({12, 34}));
+  TTS_EXPECT_NOT(grid.contains({64, 0}));
+};
+
+TTS_CASE("Check transparent lookup with kumi::transparent_hash/equal")
+{
+  using key_t = kumi::tuple<std::string, int>;
+  std::unordered_map<key_t, double, kumi::transparent_hash, kumi::transparent_equal> m;
+
+  m[{"pi", 1}] = 3.14159;
+  m[{"e" , 2}] = 2.71828;
+
+  std::string_view name = "pi";
+  int              rank = 1;
+
+  auto it = m.find(kumi::tie(name, rank));
+  TTS_EXPECT(it != m.end());
+  TTS_EQUAL(it->second, 3.14159);
+
+  TTS_EXPECT(m.contains(kumi::tuple<std::string_view, int>{"e", 2}));
+  TTS_EXPECT_NOT(m.contains(kumi::tuple<std::string_view, int>{"e", 1}));
+
+  TTS_EXPECT    (kumi::transparent_equal{}(key_t{"pi", 1}, kumi::tie(name, rank)));
+  TTS_EXPECT_NOT(kumi::transparent_equal{}(key_t{"pi", 2}, kumi::tie(name, rank)));
+};
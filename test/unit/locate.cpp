@@ -8,8 +8,12 @@
 #define TTS_MAIN
 #include <kumi/tuple.hpp>
 #include <tts/tts.hpp>
+#include <array>
 #include <type_traits>
 
+template<typename T, std::size_t N>
+struct kumi::is_product_type<std::array<T,N>> : std::true_type {};
+
 TTS_CASE("kumi locate runtime behavior")
 {
   auto values = kumi::make_tuple(1, 2.5, -3.6f, 4ULL);
@@ -32,3 +36,21 @@ TTS_CASE("kumi locate constexpr behavior")
                       , 3ULL
                       );
 };
+
+TTS_CASE("kumi locate on adapted product types")
+{
+  std::array<int,4> values = {1, 2, -3, 4};
+
+  TTS_EQUAL(kumi::locate(values, [](auto e) { return e < 0; })    , 2ULL);
+  TTS_EQUAL(kumi::locate(values, [](auto e) { return e > 10; })   , 4ULL);
+  TTS_EQUAL(kumi::locate(kumi::tuple{}, [](auto e) { return e; }) , 0ULL);
+};
+
+TTS_CASE("kumi locate stops at the first match")
+{
+  int calls = 0;
+  auto values = kumi::make_tuple(1, -2.5, -3.6f, 4ULL);
+
+  TTS_EQUAL(kumi::locate(values, [&](auto e) { ++calls; return e < 0; }), 1ULL);
+  TTS_EQUAL(calls, 2);
+};
@@ -0,0 +1,109 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/lookup.hpp>
+#include <tts/tts.hpp>
+#include <string>
+
+using big = kumi::name_index<"id", "name", "price", "qty", "side", "venue", "account", "trader", "ts", "seq", "flags", "currency", "bid", "ask", "last", "open", "high", "low", "close", "volume", "vwap", "isin", "cusip", "ric", "sedol", "mic", "lot", "tick", "status", "reason", "expiry", "strike">;
+
+TTS_CASE("Check kumi::name_index finds every name")
+{
+  TTS_EQUAL( big::find("id"), 0ULL );
+  TTS_EQUAL( big::find("name"), 1ULL );
+  TTS_EQUAL( big::find("price"), 2ULL );
+  TTS_EQUAL( big::find("qty"), 3ULL );
+  TTS_EQUAL( big::find("side"), 4ULL );
+  TTS_EQUAL( big::find("venue"), 5ULL );
+  TTS_EQUAL( big::find("account"), 6ULL );
+  TTS_EQUAL( big::find("trader"), 7ULL );
+  TTS_EQUAL( big::find("ts"), 8ULL );
+  TTS_EQUAL( big::find("seq"), 9ULL );
+  TTS_EQUAL( big::find("flags"), 10ULL );
+  TTS_EQUAL( big::find("currency"), 11ULL );
+  TTS_EQUAL( big::find("bid"), 12ULL );
+  TTS_EQUAL( big::find("ask"), 13ULL );
+  TTS_EQUAL( big::find("last"), 14ULL );
+  TTS_EQUAL( big::find("open"), 15ULL );
+  TTS_EQUAL( big::find("high"), 16ULL );
+  TTS_EQUAL( big::find("low"), 17ULL );
+  TTS_EQUAL( big::find("close"), 18ULL );
+  TTS_EQUAL( big::find("volume"), 19ULL );
+  TTS_EQUAL( big::find("vwap"), 20ULL );
+  TTS_EQUAL( big::find("isin"), 21ULL );
+  TTS_EQUAL( big::find("cusip"), 22ULL );
+  TTS_EQUAL( big::find("ric"), 23ULL );
+  TTS_EQUAL( big::find("sedol"), 24ULL );
+  TTS_EQUAL( big::find("mic"), 25ULL );
+  TTS_EQUAL( big::find("lot"), 26ULL );
+  TTS_EQUAL( big::find("tick"), 27ULL );
+  TTS_EQUAL( big::find("status"), 28ULL );
+  TTS_EQUAL( big::find("reason"), 29ULL );
+  TTS_EQUAL( big::find("expiry"), 30ULL );
+  TTS_EQUAL( big::find("strike"), 31ULL );
+};
+
+TTS_CASE("Check kumi::name_index rejects unknown names")
+{
+  TTS_EQUAL( big::find("")        , 32ULL );
+  TTS_EQUAL( big::find("prices")  , 32ULL );
+  TTS_EQUAL( big::find("pric")    , 32ULL );
+  TTS_EQUAL( big::find("PRICE")   , 32ULL );
+
+  TTS_EQUAL( kumi::name_index<"x">::find("x")   , 0ULL );
+  TTS_EQUAL( kumi::name_index<"x">::find("y")   , 1ULL );
+  TTS_EQUAL( kumi::name_index<>::find("x")      , 0ULL );
+};
+
+TTS_CASE("Check kumi::name_index constexpr behavior")
+{
+  TTS_CONSTEXPR_EQUAL( big::find("strike"), 31ULL );
+  TTS_CONSTEXPR_EQUAL( (kumi::name_index<"a","b","c">::find("b")), 1ULL );
+  TTS_CONSTEXPR_EQUAL( (kumi::name_index<"a","b","c">::find("d")), 3ULL );
+};
+
+TTS_CASE("Check kumi::visit_field on product types")
+{
+  auto t = kumi::tuple{1, 2.5, std::string{"x"}};
+  double seen = 0;
+
+  auto found = kumi::visit_field<"id","price","sym">
+               ( t, std::string{"price"}, [&](auto const& v)
+                 {
+                   if constexpr(std::is_arithmetic_v<std::remove_cvref_t<decltype(v)>>) seen = v;
+                 }
+               );
+
+  TTS_EXPECT( found );
+  TTS_EQUAL ( seen, 2.5 );
+
+  TTS_EXPECT_NOT( (kumi::visit_field<"id","price","sym">(t, "qty", [](auto const&) {})) );
+};
+
+TTS_CASE("Check kumi::visit_field on records")
+{
+  using order = kumi::record< kumi::field<"price", double>
+                            , kumi::field<"qty"  , int>
+                            , kumi::field<"sym"  , std::string>
+                            >;
+
+  TTS_EQUAL( kumi::record_index_t<order>::find("qty"), 1ULL );
+
+  order o = {12.5, 3, "ABC"};
+  auto set = [](auto& field, std::string const& text)
+  {
+    if constexpr(std::is_same_v<std::remove_cvref_t<decltype(field)>, std::string>) field = text;
+    else field = static_cast<std::remove_cvref_t<decltype(field)>>(std::stod(text));
+  };
+
+  TTS_EXPECT( kumi::visit_field(o, "qty"  , [&](auto& f) { set(f, "7");   }) );
+  TTS_EXPECT( kumi::visit_field(o, "sym"  , [&](auto& f) { set(f, "XYZ"); }) );
+  TTS_EXPECT_NOT( kumi::visit_field(o, "size", [&](auto& f) { set(f, "1"); }) );
+
+  TTS_EQUAL( o, (kumi::tuple{12.5, 7, std::string{"XYZ"}}) );
+};
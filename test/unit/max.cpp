@@ -7,7 +7,9 @@
 //==================================================================================================
 #define TTS_MAIN
 #include <array>
+#include <cmath>
 #include <kumi/tuple.hpp>
+#include <limits>
 #include <tts/tts.hpp>
 #include <vector>
 
@@ -54,3 +56,40 @@ TTS_CASE("Check tuple::max/max_flat constexpr behavior")
   constexpr auto t1 = kumi::tuple {1.5,3.6f,8,-3.6,2.4,0};
   TTS_CONSTEXPR_EQUAL((kumi::max(t1, [](auto m) { return (m-5)<0 ? (5-m) : (m-5); })), 8.6);
 };
+
+TTS_CASE("Check tuple::max behavior on homogeneous tuples")
+{
+  auto id = [](auto m) { return m; };
+
+  auto t4  = kumi::tuple{1.5f, -3.f, 8.25f, 2.f};
+  auto t8  = kumi::generate<8>(3);
+  auto t16 = kumi::tuple{ 4.,  -1., 16., 3., 7., 0.5, -9., 2.
+                        , 11., 15., 1.,  6., -2., 8.,  13., 5.
+                        };
+
+  TTS_EQUAL(kumi::max(t4 , id), 8.25f );
+  TTS_EQUAL(kumi::max(t8 , id), 3     );
+  TTS_EQUAL(kumi::max(t16, id), 16.   );
+  TTS_EQUAL(kumi::max(t16, [](auto m) { return -m; }), 9.);
+
+  auto nan = kumi::tuple{1.f, std::numeric_limits<float>::quiet_NaN(), 4.f, 2.f};
+  TTS_EQUAL(kumi::max(nan, id), 1.f);
+
+  constexpr auto c8 = kumi::tuple{3, 1, 4, 1, 5, 9, 2, 6};
+  TTS_CONSTEXPR_EQUAL(kumi::max(c8, id), 9);
+};
+
+TTS_CASE("Check tuple::max behavior on signed zeros")
+{
+  auto id = [](auto m) { return m; };
+
+  auto z = kumi::max(kumi::tuple{0.0, -0.0}, id);
+  TTS_EQUAL(z, 0.);
+  TTS_EXPECT_NOT(std::signbit(z));
+
+  auto n = kumi::max(kumi::tuple{-0.0, 0.0, -0.0, 0.0}, id);
+  TTS_EXPECT(std::signbit(n));
+
+  constexpr auto c = kumi::max(kumi::tuple{0.0, -0.0}, id);
+  TTS_EXPECT(std::signbit(c) == std::signbit(z));
+};
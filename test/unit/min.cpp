@@ -7,7 +7,9 @@
 //==================================================================================================
 #define TTS_MAIN
 #include <array>
+#include <cmath>
 #include <kumi/tuple.hpp>
+#include <limits>
 #include <tts/tts.hpp>
 #include <vector>
 
@@ -54,3 +56,40 @@ TTS_CASE("Check tuple::min/min_flat constexpr behavior")
   constexpr auto t1 = kumi::tuple {1.5,3.6f,8,-3.6,2.4,-0.5};
   TTS_CONSTEXPR_EQUAL((kumi::min(t1, [](auto m) { return m<0 ? -m : m; })), 0.5);
 };
+
+TTS_CASE("Check tuple::min behavior on homogeneous tuples")
+{
+  auto id = [](auto m) { return m; };
+
+  auto t4  = kumi::tuple{1.5f, -3.f, 8.25f, 2.f};
+  auto t8  = kumi::generate<8>(3);
+  auto t16 = kumi::tuple{ 4.,  -1., 16., 3., 7., 0.5, -9., 2.
+                        , 11., 15., 1.,  6., -2., 8.,  13., 5.
+                        };
+
+  TTS_EQUAL(kumi::min(t4 , id), -3.f  );
+  TTS_EQUAL(kumi::min(t8 , id), 3     );
+  TTS_EQUAL(kumi::min(t16, id), -9.   );
+  TTS_EQUAL(kumi::min(t16, [](auto m) { return -m; }), -16.);
+
+  auto nan = kumi::tuple{1.f, std::numeric_limits<float>::quiet_NaN(), 4.f, 2.f};
+  TTS_EQUAL(kumi::min(nan, id), 1.f);
+
+  constexpr auto c8 = kumi::tuple{3, 1, 4, 1, 5, 9, 2, 6};
+  TTS_CONSTEXPR_EQUAL(kumi::min(c8, id), 1);
+};
+
+TTS_CASE("Check tuple::min behavior on signed zeros")
+{
+  auto id = [](auto m) { return m; };
+
+  auto z = kumi::min(kumi::tuple{0.0, -0.0}, id);
+  TTS_EQUAL(z, 0.);
+  TTS_EXPECT_NOT(std::signbit(z));
+
+  auto n = kumi::min(kumi::tuple{-0.0, 0.0, -0.0, 0.0}, id);
+  TTS_EXPECT(std::signbit(n));
+
+  constexpr auto c = kumi::min(kumi::tuple{0.0, -0.0}, id);
+  TTS_EXPECT(std::signbit(c) == std::signbit(z));
+};
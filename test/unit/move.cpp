@@ -0,0 +1,127 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <memory>
+
+using ptr = std::unique_ptr<int>;
+
+// Copyable type counting the copies made
+struct counted
+{
+  static inline int copies = 0;
+  int value;
+
+  counted(int v) : value(v) {}
+  counted(counted const& o) : value(o.value) { ++copies; }
+  counted(counted&& o) noexcept : value(o.value) {}
+  counted& operator=(counted const& o) { value = o.value; ++copies; return *this; }
+  counted& operator=(counted&&) noexcept = default;
+};
+
+struct holder
+{
+  ptr a;
+  ptr b;
+};
+
+TTS_CASE("Check kumi::push_front/push_back/pop_front/pop_back on move-only elements")
+{
+  auto front = kumi::push_front(kumi::tuple{ptr{new int(2)}, ptr{new int(3)}}, ptr{new int(1)});
+  TTS_TYPE_IS( decltype(front), (kumi::tuple<ptr,ptr,ptr>) );
+  TTS_EQUAL( *get<0>(front), 1 );
+  TTS_EQUAL( *get<1>(front), 2 );
+  TTS_EQUAL( *get<2>(front), 3 );
+
+  auto back = kumi::push_back(std::move(front), ptr{new int(4)});
+  TTS_EQUAL( get<0>(front), nullptr );
+  TTS_EQUAL( *get<0>(back), 1 );
+  TTS_EQUAL( *get<3>(back), 4 );
+
+  auto popped_front = kumi::pop_front(std::move(back));
+  TTS_TYPE_IS( decltype(popped_front), (kumi::tuple<ptr,ptr,ptr>) );
+  TTS_EQUAL( *get<0>(popped_front), 2 );
+  TTS_EQUAL( *get<2>(popped_front), 4 );
+
+  auto popped_back = kumi::pop_back(std::move(popped_front));
+  TTS_TYPE_IS( decltype(popped_back), (kumi::tuple<ptr,ptr>) );
+  TTS_EQUAL( *get<0>(popped_back), 2 );
+  TTS_EQUAL( *get<1>(popped_back), 3 );
+};
+
+TTS_CASE("Check kumi::tuple::extract/split on move-only elements")
+{
+  kumi::tuple t{ptr{new int(1)}, ptr{new int(2)}, ptr{new int(3)}};
+
+  auto tail = std::move(t).extract(kumi::index<2>);
+  TTS_TYPE_IS( decltype(tail), kumi::tuple<ptr> );
+  TTS_EQUAL( *get<0>(tail), 3 );
+  TTS_EQUAL( get<2>(t), nullptr );
+  TTS_EQUAL( *get<0>(t), 1 );
+
+  auto [head, rest] = std::move(t).split(kumi::index<1>);
+  TTS_TYPE_IS( decltype(head), kumi::tuple<ptr> );
+  TTS_TYPE_IS( decltype(rest), (kumi::tuple<ptr,ptr>) );
+  TTS_EQUAL( *get<0>(head), 1 );
+  TTS_EQUAL( *get<0>(rest), 2 );
+  TTS_EQUAL( get<1>(rest), nullptr );
+};
+
+TTS_CASE("Check kumi::zip/flatten/transpose on move-only elements")
+{
+  auto zipped = kumi::zip ( kumi::tuple{ptr{new int(1)}, ptr{new int(2)}}
+                          , kumi::tuple{ptr{new int(3)}, ptr{new int(4)}}
+                          );
+  TTS_TYPE_IS( decltype(zipped), (kumi::tuple<kumi::tuple<ptr,ptr>, kumi::tuple<ptr,ptr>>) );
+  TTS_EQUAL( *get<1>(get<0>(zipped)), 3 );
+  TTS_EQUAL( *get<0>(get<1>(zipped)), 2 );
+
+  auto transposed = kumi::transpose(std::move(zipped));
+  TTS_EQUAL( *get<1>(get<0>(transposed)), 2 );
+  TTS_EQUAL( *get<0>(get<1>(transposed)), 3 );
+
+  auto flat = kumi::flatten(std::move(transposed));
+  TTS_TYPE_IS( decltype(flat), (kumi::tuple<ptr,ptr,ptr,ptr>) );
+  TTS_EQUAL( *get<0>(flat), 1 );
+  TTS_EQUAL( *get<1>(flat), 2 );
+  TTS_EQUAL( *get<2>(flat), 3 );
+  TTS_EQUAL( *get<3>(flat), 4 );
+};
+
+TTS_CASE("Check kumi::to_tuple/from_tuple on move-only elements")
+{
+  auto t = kumi::to_tuple(kumi::tuple{ptr{new int(1)}, ptr{new int(2)}});
+  TTS_TYPE_IS( decltype(t), (kumi::tuple<ptr,ptr>) );
+
+  auto h = kumi::from_tuple<holder>(std::move(t));
+  TTS_EQUAL( *h.a, 1 );
+  TTS_EQUAL( *h.b, 2 );
+  TTS_EQUAL( get<0>(t), nullptr );
+};
+
+TTS_CASE("Check rvalue builders do not copy their elements")
+{
+  auto make = []() { return kumi::tuple{counted{1}, counted{2}, counted{3}}; };
+  counted::copies = 0;
+
+  auto a = kumi::push_back(make(), counted{4});
+  auto b = kumi::pop_front(std::move(a));
+  auto c = kumi::pop_back(kumi::push_front(std::move(b), counted{0}));
+  auto d = std::move(c).split(kumi::index<1>);
+  auto e = kumi::flatten(kumi::zip(std::move(get<1>(d)), make().extract(kumi::index<1>)));
+  auto f = kumi::to_tuple(kumi::transpose(kumi::make_tuple(std::move(e))));
+
+  TTS_EQUAL( counted::copies, 0 );
+  TTS_EQUAL( get<0>(get<0>(f)).value, 2 );
+  TTS_EQUAL( get<0>(get<3>(f)).value, 3 );
+
+  auto g = kumi::push_back(f, counted{5});
+  TTS_EQUAL( counted::copies, 4 );
+  TTS_EQUAL( get<0>(get<3>(g)).value, 3 );
+};
@@ -59,3 +59,20 @@ TTS_CASE("kumi predicates constexpr behavior")
   TTS_CONSTEXPR_EXPECT_NOT(kumi::any_of(kumi::make_tuple(1, (int*)(nullptr), 3.6f, 4ULL), kumi::predicate<std::is_lvalue_reference>()));
   TTS_CONSTEXPR_EXPECT_NOT(kumi::none_of(kumi::make_tuple(1, 8.5, 3.6f, 4ULL), kumi::predicate<std::is_arithmetic>()));
 };
+
+TTS_CASE("kumi predicates behavior on homogeneous tuples")
+{
+  auto values = kumi::tuple{3.f, -1.f, 4.f, 1.f, -5.f, 9.f, 2.f, 6.f};
+
+  TTS_EXPECT    (kumi::all_of  (values, [](auto e) { return e < 10; }));
+  TTS_EXPECT_NOT(kumi::all_of  (values, [](auto e) { return e > 0;  }));
+  TTS_EXPECT    (kumi::any_of  (values, [](auto e) { return e > 8;  }));
+  TTS_EXPECT_NOT(kumi::any_of  (values, [](auto e) { return e > 9;  }));
+  TTS_EXPECT    (kumi::none_of (values, [](auto e) { return e == 0; }));
+  TTS_EQUAL     (kumi::count_if(values, [](auto e) { return e < 0;  }), 2ULL);
+
+  constexpr auto ints = kumi::tuple{3, -1, 4, 1, -5, 9, 2, 6};
+  TTS_CONSTEXPR_EXPECT(kumi::all_of(ints, [](auto e) { return e < 10; }));
+  TTS_CONSTEXPR_EXPECT(kumi::any_of(ints, [](auto e) { return e > 8;  }));
+  TTS_CONSTEXPR_EQUAL (kumi::count_if(ints, [](auto e) { return e < 0; }), 2ULL);
+};
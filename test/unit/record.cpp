@@ -0,0 +1,94 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/record.hpp>
+#include <tts/tts.hpp>
+#include <sstream>
+#include <string>
+
+using order = kumi::record< kumi::field<"price", double>
+                          , kumi::field<"qty"  , int>
+                          , kumi::field<"sym"  , std::string>
+                          >;
+
+TTS_CASE("Check kumi::record properties")
+{
+  TTS_EXPECT( kumi::product_type<order> );
+  TTS_EQUAL ( kumi::size<order>::value, 3ULL );
+  TTS_EQUAL ( sizeof(order), sizeof(kumi::tuple<double,int,std::string>) );
+
+  TTS_TYPE_IS( (kumi::element_t<0,order>), double      );
+  TTS_TYPE_IS( (kumi::element_t<2,order>), std::string );
+
+  TTS_CONSTEXPR_EQUAL( order::index_of<"price">, 0ULL );
+  TTS_CONSTEXPR_EQUAL( order::index_of<"sym">  , 2ULL );
+  TTS_CONSTEXPR_EXPECT    ( order::contains<"qty">  );
+  TTS_CONSTEXPR_EXPECT_NOT( order::contains<"size"> );
+
+  TTS_EQUAL( get<1>(order::names()), "qty" );
+};
+
+TTS_CASE("Check kumi::record access by name and index")
+{
+  using namespace kumi::literals;
+
+  order o = {12.5, 3, "ABC"};
+
+  TTS_EQUAL( get<"price">(o), 12.5  );
+  TTS_EQUAL( o["qty"_f]     , 3     );
+  TTS_EQUAL( get<2>(o)      , "ABC" );
+  TTS_EQUAL( &o["sym"_f]    , &get<2>(o) );
+
+  TTS_TYPE_IS( decltype(get<"qty">(o))            , int&  );
+  TTS_TYPE_IS( decltype(get<"qty">(std::as_const(o))), int const& );
+  TTS_TYPE_IS( decltype(get<"qty">(std::move(o)))  , int&& );
+
+  o["qty"_f] *= 2;
+  TTS_EQUAL( get<1>(o), 6 );
+
+  auto sym = get<"sym">(std::move(o));
+  TTS_EQUAL( sym, "ABC" );
+  TTS_EXPECT( get<"sym">(o).empty() );
+};
+
+TTS_CASE("Check kumi::record works with kumi algorithms")
+{
+  order o = {12.5, 3, "ABC"};
+
+  auto& [p, q, s] = o;
+  TTS_EQUAL( q, 3 );
+  TTS_EQUAL( &p, &get<"price">(o) );
+
+  TTS_EQUAL( kumi::to_tuple(o)                         , (kumi::tuple{12.5, 3, std::string{"ABC"}}) );
+  TTS_EQUAL( o                                         , (kumi::tuple{12.5, 3, std::string{"ABC"}}) );
+  TTS_EXPECT( o < (kumi::tuple{12.5, 4, std::string{"ABC"}}) );
+  TTS_EQUAL( kumi::apply([](double a, int b, auto const&) { return a * b; }, o), 37.5 );
+  TTS_EQUAL( kumi::pop_back(o)                         , (kumi::tuple{12.5, 3}) );
+
+  std::ostringstream os;
+  os << o;
+  TTS_EQUAL( os.str(), std::string{"( price: 12.5 qty: 3 sym: ABC )"} );
+};
+
+TTS_CASE("Check kumi::record constexpr behavior")
+{
+  using point = kumi::record<kumi::field<"x", int>, kumi::field<"y", int>>;
+  constexpr point pt = {1, 2};
+
+  TTS_CONSTEXPR_EQUAL( get<"y">(pt), 2 );
+  TTS_CONSTEXPR_EQUAL( kumi::fold_left([](auto a, auto b) { return a + b; }, pt, 0), 3 );
+};
+
+template<typename R>
+concept has_volume = requires(R r) { get<"volume">(r); };
+
+TTS_CASE("Check kumi::record SFINAE behavior")
+{
+  TTS_EXPECT_NOT( has_volume<order> );
+  TTS_EXPECT    ( (has_volume<kumi::record<kumi::field<"volume", int>>>) );
+};
@@ -0,0 +1,72 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <string>
+
+// Records the shape of the reduction tree
+auto const shape = [](auto a, auto b)
+{
+  return "(" + std::string(a) + " " + std::string(b) + ")";
+};
+
+TTS_CASE("Check result::reduce<...> behavior")
+{
+  auto lambda = [](auto a, auto m) { return a + m; };
+  using func_t = decltype(lambda);
+
+  TTS_TYPE_IS ( (kumi::result::reduce_t<func_t,kumi::tuple<char,short,int,double>,int>), double );
+  TTS_TYPE_IS ( (kumi::result::reduce_t<func_t,kumi::tuple<>,int>)                    , int    );
+
+  auto pair = [](auto a, auto b) { return kumi::tuple{a, b}; };
+  using pair_t  = decltype(pair);
+  using t4_t    = kumi::tuple<char,short,int,long>;
+
+  TTS_TYPE_IS ( (kumi::result::reduce_t<pair_t,t4_t,float>)
+              , (kumi::tuple<float, kumi::tuple<kumi::tuple<char,short>,kumi::tuple<int,long>>>)
+              );
+  TTS_TYPE_IS ( (kumi::result::reduce_t<pair_t,t4_t,float,4>)
+              , (kumi::tuple<float, kumi::tuple<kumi::tuple<kumi::tuple<char,short>,int>,long>>)
+              );
+  TTS_TYPE_IS ( (kumi::result::reduce_t<pair_t,t4_t,float,4>)
+              , decltype(kumi::reduce<4>(pair, t4_t{}, 1.f))
+              );
+};
+
+TTS_CASE("Check tuple::reduce behavior")
+{
+  auto t = kumi::tuple{1, 2, 3, 4, 5, 6, 7};
+  auto sum = [](auto a, auto b) { return a + b; };
+
+  TTS_EQUAL( kumi::reduce(sum, t, 100)              , 128 );
+  TTS_EQUAL( kumi::reduce<3>(sum, t, 0)             , 28  );
+  TTS_EQUAL( kumi::reduce(sum, kumi::tuple{}, 42)   , 42  );
+  TTS_EQUAL( kumi::reduce(sum, kumi::tuple{1.5}, 1) , 2.5 );
+  TTS_EQUAL( kumi::reduce(sum, t, 0)                , kumi::fold_left(sum, t, 0) );
+};
+
+TTS_CASE("Check tuple::reduce builds a balanced tree")
+{
+  auto t = kumi::tuple{"a", "b", "c", "d", "e"};
+
+  TTS_EQUAL( kumi::reduce(shape, t, "i")    , "(i (((a b) c) (d e)))" );
+  TTS_EQUAL( kumi::reduce<3>(shape, t, "i") , "(i (((a b) (c d)) e))" );
+  TTS_EQUAL( kumi::reduce<8>(shape, t, "i") , "(i ((((a b) c) d) e))" );
+
+  auto s = kumi::tuple{"a", "b", "c", "d", "e", "f", "g", "h"};
+  TTS_EQUAL( kumi::reduce(shape, s, "i"), "(i (((a b) (c d)) ((e f) (g h))))" );
+};
+
+TTS_CASE("Check tuple::reduce constexpr behavior")
+{
+  constexpr auto t = kumi::tuple{1, 2.5, 'a', short{4}};
+
+  TTS_CONSTEXPR_EQUAL( kumi::reduce([](auto a, auto b) { return a + b; }, t, 0), 104.5 );
+  TTS_CONSTEXPR_EQUAL( kumi::reduce<4>([](auto a, auto b) { return a * b; }, kumi::iota<5>(1), 1), 120 );
+};
@@ -0,0 +1,199 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <functional>
+#include <string>
+
+// Records the exact types a callable object is invoked with
+template<typename... Ts> struct seen {};
+
+struct probe
+{
+  template<typename... Args> seen<Args&&...> operator()(Args&&...) const { return {}; }
+};
+
+struct mutable_probe
+{
+  template<typename... Args> seen<Args&&...> operator()(Args&&...) { return {}; }
+};
+
+struct pointer_to
+{
+  template<typename T> T* operator()(T& m) const { return &m; }
+};
+
+template<typename T> struct is_integral_type : std::is_integral<T> {};
+template<typename T> struct type_size        : std::integral_constant<std::size_t, sizeof(T)> {};
+
+using flat_t   = kumi::tuple<char, float const, std::string, std::reference_wrapper<int>>;
+using nested_t = kumi::tuple< int, kumi::tuple<>, kumi::tuple<float, kumi::tuple<char const>>
+                            , std::string, kumi::tuple<kumi::tuple<double>>
+                            >;
+using matrix_t = kumi::tuple< kumi::tuple<char, std::string const, short>
+                            , kumi::tuple<int , float, std::reference_wrapper<double>>
+                            >;
+
+#define KUMI_SAME_AS_CALL(TRAIT, ...)  TTS_TYPE_IS( TRAIT, (decltype(__VA_ARGS__)) )
+
+TTS_CASE_TPL( "Check result traits of structural algorithms match their functions"
+            , flat_t, flat_t&, flat_t const&, flat_t const
+            , kumi::tuple<int&, short const&, double>
+            , kumi::tuple<int&, short const&, double> const&
+            , kumi::compact_tuple<char, double, short>&
+            )
+<typename T>(::tts::type<T>)
+{
+  using namespace kumi;
+
+  KUMI_SAME_AS_CALL( (result::apply_t<probe, T>)            , kumi::apply(probe{}, std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::map_t<probe, T>)              , kumi::map(probe{}, std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::map_t<probe, T, T>)           , kumi::map(probe{}, std::declval<T>(), std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::map_index_t<probe, T>)        , kumi::map_index(probe{}, std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::fold_left_t<probe, T, long>)  , kumi::fold_left(probe{}, std::declval<T>(), 1L) );
+  KUMI_SAME_AS_CALL( (result::fold_right_t<probe, T, long>) , kumi::fold_right(probe{}, std::declval<T>(), 1L) );
+  KUMI_SAME_AS_CALL( (result::reduce_t<probe, T, long>)     , kumi::reduce(probe{}, std::declval<T>(), 1L) );
+  KUMI_SAME_AS_CALL( (result::reduce_t<mutable_probe, T, long&>)
+                   , kumi::reduce(mutable_probe{}, std::declval<T>(), std::declval<long&>())
+                   );
+  KUMI_SAME_AS_CALL( (result::reduce_t<probe, T, long, 3>)  , kumi::reduce<3>(probe{}, std::declval<T>(), 1L) );
+
+  KUMI_SAME_AS_CALL( (result::cat_t<T>)                     , kumi::cat(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::cat_t<T, nested_t, T>)        , kumi::cat(std::declval<T>(), nested_t{}, std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::push_front_t<T, int&>)        , kumi::push_front(std::declval<T>(), std::declval<int&>()) );
+  KUMI_SAME_AS_CALL( (result::push_back_t<T, std::reference_wrapper<long>>)
+                   , kumi::push_back(std::declval<T>(), std::declval<std::reference_wrapper<long>>())
+                   );
+  KUMI_SAME_AS_CALL( (result::pop_front_t<T>)               , kumi::pop_front(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::pop_back_t<T>)                , kumi::pop_back(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_t<T>)                 , kumi::flatten(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<T>)             , kumi::flatten_all(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<T, probe>)      , kumi::flatten_all(std::declval<T>(), probe{}) );
+  KUMI_SAME_AS_CALL( (result::zip_t<T, T>)                  , kumi::zip(std::declval<T>(), std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::cartesian_product_t<T, nested_t>)
+                   , kumi::cartesian_product(std::declval<T>(), nested_t{})
+                   );
+  KUMI_SAME_AS_CALL( (result::filter_t<is_integral_type, T>), kumi::filter<is_integral_type>(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::partition_t<is_integral_type, T>)
+                   , kumi::partition<is_integral_type>(std::declval<T>())
+                   );
+  KUMI_SAME_AS_CALL( (result::sort_by_t<type_size, T>)      , kumi::sort_by<type_size>(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::generate_t<3, T>)             , kumi::generate<3>(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::generate_t<1, T>)             , kumi::generate<1>(std::declval<T>()) );
+};
+
+TTS_CASE_TPL( "Check result traits of kumi::tuple members match their functions"
+            , flat_t, flat_t&, flat_t const&, kumi::tuple<int&, short const&, double>
+            )
+<typename T>(::tts::type<T>)
+{
+  using namespace kumi;
+
+  KUMI_SAME_AS_CALL( (result::split_t<T, 0>)    , std::declval<T>().split(index<0>) );
+  KUMI_SAME_AS_CALL( (result::split_t<T, 2>)    , std::declval<T>().split(index<2>) );
+  KUMI_SAME_AS_CALL( (result::split_t<T, 3>)    , std::declval<T>().split(index<3>) );
+  KUMI_SAME_AS_CALL( (result::reorder_t<T,2,0>) , kumi::reorder<2,0>(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::reorder_t<T>)     , kumi::reorder<>(std::declval<T>()) );
+};
+
+TTS_CASE_TPL( "Check result traits of nested tuples match their functions"
+            , nested_t, nested_t&, nested_t const&, matrix_t, matrix_t const&
+            )
+<typename T>(::tts::type<T>)
+{
+  using namespace kumi;
+
+  KUMI_SAME_AS_CALL( (result::flatten_t<T>)                 , kumi::flatten(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<T>)             , kumi::flatten_all(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<T, probe>)      , kumi::flatten_all(std::declval<T>(), probe{}) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<T, pointer_to&>)
+                   , kumi::flatten_all(std::declval<T>(), std::declval<pointer_to&>())
+                   );
+  KUMI_SAME_AS_CALL( (result::as_flat_ptr_t<T>)             , kumi::as_flat_ptr(std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::cat_t<T, T>)                  , kumi::cat(std::declval<T>(), std::declval<T>()) );
+  KUMI_SAME_AS_CALL( (result::fold_right_t<probe, T, long>) , kumi::fold_right(probe{}, std::declval<T>(), 1L) );
+  KUMI_SAME_AS_CALL( (result::reduce_t<probe, T, long>)     , kumi::reduce(probe{}, std::declval<T>(), 1L) );
+  KUMI_SAME_AS_CALL( (result::generate_t<2, T>)             , kumi::generate<2>(std::declval<T>()) );
+};
+
+TTS_CASE("Check result traits of transpose match their functions")
+{
+  using namespace kumi;
+
+  KUMI_SAME_AS_CALL( (result::transpose_t<matrix_t>)        , kumi::transpose(std::declval<matrix_t>()) );
+  KUMI_SAME_AS_CALL( (result::transpose_t<matrix_t const&>) , kumi::transpose(std::declval<matrix_t const&>()) );
+  KUMI_SAME_AS_CALL( (result::transpose_t<tuple<>>)         , kumi::transpose(tuple{}) );
+  KUMI_SAME_AS_CALL( (result::transpose_t<tuple<tuple<>>>)  , kumi::transpose(tuple<tuple<>>{}) );
+};
+
+TTS_CASE("Check result traits of empty tuples match their functions")
+{
+  using namespace kumi;
+  using e_t = tuple<>;
+
+  KUMI_SAME_AS_CALL( (result::apply_t<probe, e_t>)          , kumi::apply(probe{}, e_t{}) );
+  KUMI_SAME_AS_CALL( (result::map_t<probe, e_t const&>)     , kumi::map(probe{}, e_t{}) );
+  KUMI_SAME_AS_CALL( (result::map_index_t<probe, e_t>)      , kumi::map_index(probe{}, e_t{}) );
+  KUMI_SAME_AS_CALL( (result::fold_left_t<probe, e_t, int&>), kumi::fold_left(probe{}, e_t{}, std::declval<int&>()) );
+  KUMI_SAME_AS_CALL( (result::fold_right_t<probe, e_t, int>), kumi::fold_right(probe{}, e_t{}, 1) );
+  KUMI_SAME_AS_CALL( (result::reduce_t<probe, e_t, int>)    , kumi::reduce(probe{}, e_t{}, 1) );
+  KUMI_SAME_AS_CALL( (result::cat_t<>)                      , kumi::cat() );
+  KUMI_SAME_AS_CALL( (result::cat_t<e_t, e_t>)              , kumi::cat(e_t{}, e_t{}) );
+  KUMI_SAME_AS_CALL( (result::push_front_t<e_t, char>)      , kumi::push_front(e_t{}, 'z') );
+  KUMI_SAME_AS_CALL( (result::pop_front_t<e_t>)             , kumi::pop_front(e_t{}) );
+  KUMI_SAME_AS_CALL( (result::pop_back_t<tuple<int>>)       , kumi::pop_back(tuple<int>{}) );
+  KUMI_SAME_AS_CALL( (result::flatten_t<e_t&>)              , kumi::flatten(std::declval<e_t&>()) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<e_t>)           , kumi::flatten_all(e_t{}) );
+  KUMI_SAME_AS_CALL( (result::flatten_all_t<e_t, probe>)    , kumi::flatten_all(e_t{}, probe{}) );
+  KUMI_SAME_AS_CALL( (result::as_flat_ptr_t<e_t>)           , kumi::as_flat_ptr(e_t{}) );
+  KUMI_SAME_AS_CALL( (result::zip_t<e_t, e_t>)              , kumi::zip(e_t{}, e_t{}) );
+  KUMI_SAME_AS_CALL( (result::cartesian_product_t<>)        , kumi::cartesian_product() );
+  KUMI_SAME_AS_CALL( (result::cartesian_product_t<e_t, tuple<int>>)
+                   , kumi::cartesian_product(e_t{}, tuple<int>{})
+                   );
+  KUMI_SAME_AS_CALL( (result::generate_t<0, int>)           , kumi::generate<0>(1) );
+  KUMI_SAME_AS_CALL( (result::iota_t<0, int>)               , kumi::iota<0>(1) );
+};
+
+TTS_CASE("Check result traits of value generators match their functions")
+{
+  using namespace kumi;
+  using ref_t = std::reference_wrapper<int>;
+
+  KUMI_SAME_AS_CALL( (result::generate_t<3, int const&>)    , kumi::generate<3>(std::declval<int const&>()) );
+  KUMI_SAME_AS_CALL( (result::generate_t<2, ref_t>)         , kumi::generate<2>(std::declval<ref_t>()) );
+  KUMI_SAME_AS_CALL( (result::iota_t<4, short&>)            , kumi::iota<4>(std::declval<short&>()) );
+  KUMI_SAME_AS_CALL( (result::iota_t<2, double const>)      , kumi::iota<2>(std::declval<double const>()) );
+};
+
+TTS_CASE("Check result traits of extrema match their functions")
+{
+  using namespace kumi;
+
+  auto id     = [](auto x) { return x; };
+  auto twice  = [](auto const& x) { return x + x; };
+  auto size   = [](auto const& x) -> std::size_t { return sizeof(x); };
+  using id_t  = decltype(id);
+  using tw_t  = decltype(twice);
+  using sz_t  = decltype(size);
+
+  using mixed_t   = tuple<char, short, float, int>;
+  using mono_t    = tuple<float, float, float, float>;
+  using nested_t  = tuple<char, tuple<short, tuple<double>>, int>;
+
+  KUMI_SAME_AS_CALL( (result::max_t<mixed_t, id_t>)         , kumi::max(mixed_t{}, id) );
+  KUMI_SAME_AS_CALL( (result::min_t<mixed_t const&, tw_t>)  , kumi::min(mixed_t{}, twice) );
+  KUMI_SAME_AS_CALL( (result::max_t<mono_t, tw_t>)          , kumi::max(mono_t{}, twice) );
+  KUMI_SAME_AS_CALL( (result::min_t<mono_t, sz_t&>)         , kumi::min(mono_t{}, size) );
+  KUMI_SAME_AS_CALL( (result::max_t<tuple<char>, tw_t>)     , kumi::max(tuple<char>{}, twice) );
+  KUMI_SAME_AS_CALL( (result::min_t<short, tw_t>)           , kumi::min(short{}, twice) );
+  KUMI_SAME_AS_CALL( (result::max_flat_t<nested_t, id_t>)   , kumi::max_flat(nested_t{}, id) );
+  KUMI_SAME_AS_CALL( (result::min_flat_t<nested_t&, tw_t>)  , kumi::min_flat(nested_t{}, twice) );
+  KUMI_SAME_AS_CALL( (result::min_flat_t<char, tw_t>)       , kumi::min_flat('z', twice) );
+};
@@ -0,0 +1,181 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/serialize.hpp>
+#include <tts/tts.hpp>
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ns
+{
+  struct point { float x, y; };
+  struct handle { int* data; int size; };
+
+  struct people
+  {
+    std::string name;
+    int         age;
+  };
+
+  template<std::size_t I> decltype(auto) get(people const& s) noexcept
+  {
+    if constexpr(I==0) return (s.name);
+    if constexpr(I==1) return (s.age);
+  }
+
+  template<std::size_t I> decltype(auto) get(people& s) noexcept
+  {
+    if constexpr(I==0) return (s.name);
+    if constexpr(I==1) return (s.age);
+  }
+
+  bool operator==(point const& a, point const& b) { return a.x == b.x && a.y == b.y; }
+  std::ostream& operator<<(std::ostream& os, point const& p) { return os << p.x << ',' << p.y; }
+  bool operator==(people const& a, people const& b) { return a.name == b.name && a.age == b.age; }
+}
+
+template<> struct kumi::is_product_type<ns::people> : std::true_type {};
+template<> struct kumi::is_bitwise_serializable<ns::point> : std::true_type {};
+template<> struct std::tuple_size<ns::people> : std::integral_constant<std::size_t,2> {};
+template<> struct std::tuple_element<0,ns::people> { using type = std::string;  };
+template<> struct std::tuple_element<1,ns::people> { using type = int;          };
+
+TTS_CASE("Check kumi::serializable")
+{
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<kumi::tuple<>>)                                 );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<kumi::tuple<int,double,char>>)                  );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<kumi::tuple<int,kumi::tuple<float,ns::point>>>) );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<kumi::tuple<std::string,std::vector<short>>>)   );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<ns::people>)                                    );
+  TTS_CONSTEXPR_EXPECT    ( (kumi::serializable<kumi::tuple<bool,std::byte,int[4]>>)            );
+
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<int>)                                           );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<int*>>)                             );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<int&>>)                             );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<int const>>)                        );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<std::vector<std::string>>>)         );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<std::string_view>>)                 );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<std::span<int>>>)                   );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<std::span<int,4>>>)                 );
+  TTS_CONSTEXPR_EXPECT_NOT( (kumi::serializable<kumi::tuple<ns::handle>>)                       );
+};
+
+TTS_CASE("Check kumi::serialize/deserialize on trivially copyable tuples")
+{
+  using tuple_t = kumi::tuple<int, double, char, kumi::tuple<float, ns::point>>;
+  auto t = tuple_t{42, 3.5, 'z', {1.25f, {-1.f, 2.f}}};
+
+  auto bytes = kumi::serialize(t);
+  TTS_EQUAL(bytes.size(), kumi::serialized_size(t));
+  TTS_EQUAL(bytes.size(), 24 + sizeof(tuple_t));
+
+  auto r = kumi::deserialize<tuple_t>(bytes);
+  TTS_EXPECT(r.has_value());
+  TTS_EQUAL(*r, t);
+
+  auto e = kumi::deserialize<kumi::tuple<>>(kumi::serialize(kumi::tuple{}));
+  TTS_EXPECT(e.has_value());
+};
+
+TTS_CASE("Check kumi::serialize/deserialize on tuples with ranges")
+{
+  using tuple_t = kumi::tuple<std::string, int, kumi::tuple<std::vector<short>, char>>;
+  auto t = tuple_t{"some text", 7, {std::vector<short>{1, 2, 3, 4, 5}, 'x'}};
+
+  auto bytes = kumi::serialize(t);
+  TTS_EQUAL(bytes.size(), kumi::serialized_size(t));
+  TTS_EQUAL(bytes.size(), 24ULL + (8 + 9) + 4 + (8 + 5 * 2) + 1);
+
+  auto r = kumi::deserialize<tuple_t>(bytes);
+  TTS_EXPECT(r.has_value());
+  TTS_EXPECT(*r == t);
+};
+
+TTS_CASE("Check kumi::serialize/deserialize on adapted types")
+{
+  auto peter = ns::people{"Peter Parker", 24};
+
+  auto bytes  = kumi::serialize(peter);
+  auto r      = kumi::deserialize<ns::people>(bytes);
+  TTS_EXPECT(r.has_value());
+  TTS_EXPECT(*r == peter);
+};
+
+TTS_CASE("Check kumi::serialize into a preallocated buffer")
+{
+  auto t = kumi::tuple{1, 2.f, std::string("three")};
+
+  std::array<std::byte, 128> buffer = {};
+  auto used = kumi::serialize(t, buffer);
+  TTS_EQUAL(used.size(), kumi::serialized_size(t));
+  TTS_EQUAL(used.data(), buffer.data());
+
+  // Trailing bytes are ignored
+  auto r = kumi::deserialize<decltype(t)>(buffer);
+  TTS_EXPECT(r.has_value());
+  TTS_EQUAL(*r, t);
+
+  std::array<std::byte, 16> small = {};
+  TTS_EXPECT(kumi::serialize(t, small).empty());
+};
+
+TTS_CASE("Check kumi::deserialize rejects invalid buffers")
+{
+  auto t      = kumi::tuple{1, 2.f, std::string("three")};
+  auto bytes  = kumi::serialize(t);
+
+  // Different layout
+  TTS_EXPECT_NOT((kumi::deserialize<kumi::tuple<int, float, std::vector<int>>>(bytes)));
+  TTS_EXPECT_NOT((kumi::deserialize<kumi::tuple<int, float>>(bytes)));
+  TTS_EXPECT_NOT((kumi::deserialize<kumi::tuple<unsigned, float, std::string>>(bytes)));
+
+  // Truncated
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(std::span(bytes).first(bytes.size() - 1))));
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(std::span(bytes).first(10))));
+
+  // Wrong version
+  auto other = bytes;
+  other[4] = std::byte{0xFF};
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(other)));
+
+  // Corrupted range size
+  other = bytes;
+  other[24 + 8] = std::byte{0xFF};
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(other)));
+};
+
+TTS_CASE("Check kumi::deserialize rejects invalid bool values")
+{
+  auto t      = kumi::tuple{true, 'x', kumi::tuple{false, 3}};
+  auto bytes  = kumi::serialize(t);
+
+  auto r = kumi::deserialize<decltype(t)>(bytes);
+  TTS_EXPECT(r.has_value());
+  TTS_EQUAL(*r, t);
+
+  auto other = bytes;
+  other[24] = std::byte{2};
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(other)));
+
+  other = bytes;
+  other[26] = std::byte{0xFF};
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(t)>(other)));
+
+  kumi::tuple<bool[3]> a{{true, false, true}};
+  auto ab = kumi::serialize(a);
+  auto ra = kumi::deserialize<decltype(a)>(ab);
+  TTS_EXPECT(ra.has_value());
+  TTS_EXPECT(get<0>(*ra)[0] && !get<0>(*ra)[1] && get<0>(*ra)[2]);
+  ab.back() = std::byte{7};
+  TTS_EXPECT_NOT((kumi::deserialize<decltype(a)>(ab)));
+};
@@ -0,0 +1,195 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/soa_vector.hpp>
+#include <tts/tts.hpp>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <ranges>
+#include <string>
+
+TTS_CASE("Check kumi::soa_vector construction and properties")
+{
+  kumi::soa_vector<float, int> empty;
+  TTS_EXPECT(empty.empty());
+  TTS_EQUAL(empty.size(), 0ULL);
+
+  kumi::soa_vector<float, int> v(10);
+  TTS_EQUAL(v.size(), 10ULL);
+  TTS_EXPECT(v.capacity() >= 10ULL);
+  TTS_EQUAL(v[3], (kumi::tuple{0.f, 0}));
+};
+
+TTS_CASE("Check kumi::soa_vector row access")
+{
+  kumi::soa_vector<float, int, std::string> v;
+
+  for(int i = 0; i < 100; ++i)
+    v.push_back(kumi::tuple{1.5f * i, i, std::to_string(i)});
+
+  v.emplace_back(-1.f, -1, "last");
+
+  TTS_EQUAL(v.size(), 101ULL);
+  TTS_EQUAL(v[42] , (kumi::tuple{63.f, 42, std::string{"42"}}));
+  TTS_EQUAL(v[100], (kumi::tuple{-1.f, -1, std::string{"last"}}));
+
+  TTS_TYPE_IS( decltype(v[0]), (kumi::tuple<float&, int&, std::string&>) );
+
+  auto [f, i, s] = v[7];
+  f = 0.5f;
+  i = 77;
+  s = "seven";
+  TTS_EQUAL(v[7], (kumi::tuple{0.5f, 77, std::string{"seven"}}));
+
+  v.pop_back();
+  TTS_EQUAL(v.size(), 100ULL);
+
+  int count = 0;
+  for(auto row : v) count += get<1>(row);
+  TTS_EQUAL(count, 4950 - 7 + 77);
+};
+
+TTS_CASE("Check kumi::soa_vector column access")
+{
+  using vector_t = kumi::soa_vector<float, double, char>;
+
+  vector_t v;
+  for(int i = 0; i < 37; ++i) v.emplace_back(float(i), 2. * i, 'a');
+
+  auto cols = v.columns();
+  kumi::for_each( [](auto col)
+                  {
+                    auto address = reinterpret_cast<std::uintptr_t>(col.data());
+                    TTS_EQUAL(address % vector_t::alignment, 0ULL);
+                    TTS_EQUAL(col.size(), 37ULL);
+                  }
+                , cols
+                );
+
+  for(auto& e : v.column<0>()) e *= 2;
+
+  auto sums = kumi::map ( [](auto col)
+                          {
+                            double s = 0;
+                            for(auto e : col) s += e;
+                            return s;
+                          }
+                        , cols
+                        );
+
+  TTS_EQUAL(sums, (kumi::tuple{1332., 1332., 37. * 'a'}));
+};
+
+TTS_CASE("Check kumi::soa_vector copy and move semantic")
+{
+  kumi::soa_vector<int, std::string> v;
+  for(int i = 0; i < 20; ++i) v.emplace_back(i, std::string(32, char('a' + i)));
+
+  auto copy = v;
+  TTS_EQUAL(copy.size(), v.size());
+  TTS_EQUAL(copy[19], v[19]);
+
+  get<1>(copy[0]) = "changed";
+  TTS_EQUAL(get<1>(v[0]), std::string(32, 'a'));
+
+  auto moved = std::move(copy);
+  TTS_EQUAL(moved.size(), 20ULL);
+  TTS_EQUAL(get<1>(moved[0]), std::string{"changed"});
+
+  moved.resize(5);
+  TTS_EQUAL(moved.size(), 5ULL);
+  moved.clear();
+  TTS_EXPECT(moved.empty());
+};
+
+TTS_CASE("Check kumi::soa_vector growth from its own rows")
+{
+  kumi::soa_vector<int, std::string> v;
+  v.emplace_back(1, std::string(32, 'a'));
+  while(v.size() < v.capacity()) v.emplace_back(0, std::string{});
+
+  auto capacity = v.capacity();
+  v.push_back(v[0]);
+  TTS_GREATER(v.capacity(), capacity);
+  TTS_EQUAL(v[v.size() - 1], v[0]);
+
+  while(v.size() < v.capacity()) v.emplace_back(0, std::string{});
+  v.emplace_back(get<0>(v[0]), get<1>(v[0]));
+  TTS_EQUAL(get<1>(v[v.size() - 1]), std::string(32, 'a'));
+};
+
+struct fragile
+{
+  static inline int budget = -1;
+
+  std::string value;
+
+  fragile(std::string v = {}) : value(std::move(v)) {}
+  fragile(fragile&& o) : value(std::move(o.value)) {}
+  fragile(fragile const& o) : value(o.value)
+  {
+    if(budget == 0) throw 42;
+    if(budget > 0) --budget;
+  }
+
+  friend bool operator==(fragile const&, fragile const&) = default;
+  friend std::ostream& operator<<(std::ostream& os, fragile const& f) { return os << f.value; }
+};
+
+TTS_CASE("Check kumi::soa_vector strong exception guarantee on reallocation")
+{
+  kumi::soa_vector<std::string, fragile> v;
+  for(int i = 0; i < 8; ++i) v.emplace_back(std::string(32, char('a' + i)), std::string(32, 'z'));
+
+  auto capacity = v.capacity();
+  auto copy     = v;
+
+  fragile::budget = 3;
+  TTS_THROW(v.reserve(4 * capacity), int);
+  fragile::budget = 5;
+  TTS_THROW(v.emplace_back(std::string(32, 'x'), std::string(32, 'y')), int);
+  fragile::budget = -1;
+
+  TTS_EQUAL(v.capacity(), capacity);
+  TTS_EQUAL(v.size()    , copy.size());
+  for(std::size_t i = 0; i < v.size(); ++i) TTS_EQUAL(v[i], copy[i]);
+
+  v.reserve(4 * capacity);
+  TTS_EQUAL(v.capacity(), 4 * capacity);
+  for(std::size_t i = 0; i < v.size(); ++i) TTS_EQUAL(v[i], copy[i]);
+};
+
+TTS_CASE("Check kumi::soa_vector iterators")
+{
+  using v_t = kumi::soa_vector<int, double>;
+  using it  = v_t::iterator;
+  using cit = v_t::const_iterator;
+
+  // Rows are kumi::tuple of references without a common reference with kumi::tuple of values
+  TTS_CONSTEXPR_EXPECT_NOT(std::indirectly_readable<it>);
+  TTS_CONSTEXPR_EXPECT_NOT(std::random_access_iterator<it>);
+  TTS_CONSTEXPR_EXPECT_NOT(std::random_access_iterator<cit>);
+  TTS_CONSTEXPR_EXPECT_NOT(std::ranges::random_access_range<v_t>);
+  TTS_TYPE_IS(std::iterator_traits<it>::iterator_category , std::input_iterator_tag);
+  TTS_TYPE_IS(std::iterator_traits<cit>::iterator_category, std::input_iterator_tag);
+  TTS_CONSTEXPR_EXPECT((std::convertible_to<it, cit>));
+  TTS_CONSTEXPR_EXPECT_NOT((std::convertible_to<cit, it>));
+
+  v_t v;
+  for(int i = 0; i < 10; ++i) v.emplace_back(i, 1.5 * i);
+
+  cit c = v.begin() + 3;
+  TTS_EQUAL(*c, (kumi::tuple{3, 4.5}));
+  TTS_EXPECT(c == v.begin() + 3);
+  TTS_EQUAL(v.end() - c, 7);
+
+  int sum = 0;
+  for(auto&& [i, d] : v) sum += i;
+  TTS_EQUAL(sum, 45);
+};
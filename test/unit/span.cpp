@@ -0,0 +1,68 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/span.hpp>
+#include <tts/tts.hpp>
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+struct empty {};
+
+TTS_CASE("Check kumi::contiguous_product_type concept")
+{
+  TTS_EXPECT    ( (kumi::contiguous_product_type<kumi::tuple<float,float,float,float>>) );
+  TTS_EXPECT    ( (kumi::contiguous_product_type<kumi::tuple<double>>)                  );
+  TTS_EXPECT    ( (kumi::contiguous_product_type<kumi::tuple<std::string,std::string>>) );
+  TTS_EXPECT    ( (kumi::contiguous_product_type<decltype(kumi::generate<16>('c'))>)    );
+  TTS_EXPECT_NOT( (kumi::contiguous_product_type<kumi::tuple<float,int>>)               );
+  TTS_EXPECT_NOT( (kumi::contiguous_product_type<kumi::tuple<int&,int&>>)               );
+  TTS_EXPECT_NOT( (kumi::contiguous_product_type<kumi::tuple<empty,empty>>)             );
+  TTS_EXPECT_NOT( (kumi::contiguous_product_type<kumi::tuple<>>)                        );
+  TTS_EXPECT_NOT( (kumi::contiguous_product_type<kumi::compact_tuple<int,int>>)         );
+};
+
+TTS_CASE("Check kumi::as_span behavior")
+{
+  auto t = kumi::tuple{4.f, 1.f, 3.f, 2.f};
+  auto s = kumi::as_span(t);
+
+  TTS_TYPE_IS( decltype(s), (std::span<float,4>) );
+  TTS_EQUAL( std::accumulate(s.begin(), s.end(), 0.f), 10.f );
+
+  std::sort(s.begin(), s.end());
+  TTS_EQUAL( t, (kumi::tuple{1.f, 2.f, 3.f, 4.f}) );
+
+  auto const& ct = t;
+  auto cs = kumi::as_span(ct);
+  TTS_TYPE_IS( decltype(cs), (std::span<float const,4>) );
+  TTS_EQUAL( cs.data(), &get<0>(t) );
+  TTS_EQUAL( &cs[3]   , &get<3>(t) );
+
+  auto strings = kumi::tuple{std::string{"b"}, std::string{"a"}};
+  auto ss = kumi::as_span(strings);
+  std::sort(ss.begin(), ss.end());
+  TTS_EQUAL( get<0>(strings), "a" );
+};
+
+TTS_CASE("Check kumi::as_array behavior")
+{
+  auto t = kumi::generate<4>(2.5);
+  TTS_TYPE_IS( decltype(kumi::as_array(t)), (std::array<double,4>) );
+  TTS_EQUAL( kumi::as_array(t), (std::array<double,4>{2.5, 2.5, 2.5, 2.5}) );
+
+  int a = 1, b = 2;
+  TTS_EQUAL( kumi::as_array(kumi::tuple<int&,int&>{a, b}), (std::array<int,2>{1, 2}) );
+
+  auto strings = kumi::tuple{std::string{"a"}, std::string{"b"}};
+  auto moved = kumi::as_array(std::move(strings));
+  TTS_EQUAL( moved[1], "b" );
+  TTS_EXPECT( get<1>(strings).empty() );
+
+  TTS_CONSTEXPR_EQUAL( kumi::as_array(kumi::iota<3>(1))[2], 3 );
+};
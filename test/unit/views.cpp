@@ -0,0 +1,264 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/views.hpp>
+#include <tts/tts.hpp>
+#include <string>
+
+struct counted
+{
+  static inline int copies = 0;
+
+  int value = 0;
+
+  counted(int v) : value(v) {}
+  counted(counted const& o) : value(o.value) { ++copies; }
+  counted(counted&&) = default;
+  counted& operator=(counted const&) = default;
+  counted& operator=(counted&&) = default;
+
+  friend bool operator==(counted const& a, counted const& b) { return a.value == b.value; }
+  friend std::ostream& operator<<(std::ostream& os, counted const& c) { return os << c.value; }
+};
+
+TTS_CASE("Check views::cat behavior")
+{
+  auto a = kumi::tuple{1, 2.5};
+  auto b = kumi::tuple{'z', std::string("text")};
+
+  auto v = kumi::views::cat(a, kumi::tuple{}, b);
+
+  TTS_CONSTEXPR_EXPECT((kumi::product_type<decltype(v)>));
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(v)>::value, 4ULL);
+  TTS_TYPE_IS((kumi::element_t<3,decltype(v)>), std::string);
+  TTS_TYPE_IS(decltype(get<3>(v)), std::string&);
+
+  TTS_EQUAL(kumi::to_tuple(v), kumi::cat(a,b));
+
+  get<0>(v) = 42;
+  get<3>(v) += "!";
+  TTS_EQUAL(get<0>(a), 42);
+  TTS_EQUAL(get<1>(b), std::string("text!"));
+
+  auto owning = kumi::views::cat(kumi::tuple{std::string("x")}, b);
+  TTS_EQUAL(kumi::to_tuple(owning), (kumi::tuple{std::string("x"), 'z', std::string("text!")}));
+
+  auto const& cv = v;
+  TTS_TYPE_IS(decltype(get<3>(cv)), std::string&);
+  TTS_TYPE_IS(decltype(get<0>(kumi::views::cat(std::as_const(a)))), int const&);
+};
+
+TTS_CASE("Check views::zip behavior")
+{
+  auto a = kumi::tuple{1, 2.5, 'c'};
+  auto b = kumi::tuple{std::string("x"), 4.f, short{7}};
+
+  auto v = kumi::views::zip(a, b);
+
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(v)>::value, 3ULL);
+  TTS_TYPE_IS((kumi::element_t<0,decltype(v)>), (kumi::tuple<int,std::string>));
+  TTS_TYPE_IS(decltype(get<0>(v)), (kumi::tuple<int&,std::string&>));
+
+  TTS_EQUAL(kumi::to_tuple(v), kumi::zip(a,b));
+  TTS_TYPE_IS(decltype(kumi::to_tuple(v)), decltype(kumi::zip(a,b)));
+
+  get<0>(get<1>(v)) = 9.5;
+  TTS_EQUAL(get<1>(a), 9.5);
+};
+
+TTS_CASE("Check views::reorder behavior")
+{
+  auto t = kumi::tuple{1, 2.5, 'c', std::string("text")};
+  auto v = kumi::views::reorder<3,0,0,1>(t);
+
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(v)>::value, 4ULL);
+  TTS_TYPE_IS((kumi::element_t<0,decltype(v)>), std::string);
+  TTS_EQUAL(kumi::to_tuple(v), (kumi::reorder<3,0,0,1>(t)));
+
+  get<1>(v) = 7;
+  TTS_EQUAL(get<2>(v), 7);
+  TTS_EQUAL(get<0>(t), 7);
+
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(kumi::views::reorder<>(t))>::value, 0ULL);
+};
+
+TTS_CASE("Check views::transpose behavior")
+{
+  auto t = kumi::tuple{ kumi::tuple{1, 'a', 0.1}
+                      , kumi::tuple{2, 'b', 0.2}
+                      };
+  auto v = kumi::views::transpose(t);
+
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(v)>::value, 3ULL);
+  TTS_TYPE_IS((kumi::element_t<1,decltype(v)>), (kumi::tuple<char,char>));
+  TTS_EQUAL(kumi::to_tuple(v), kumi::transpose(t));
+  TTS_TYPE_IS(decltype(kumi::to_tuple(v)), decltype(kumi::transpose(t)));
+
+  get<1>(get<2>(v)) = 4.2;
+  TTS_EQUAL(get<2>(get<1>(t)), 4.2);
+
+  TTS_CONSTEXPR_EQUAL(kumi::size<decltype(kumi::views::transpose(kumi::tuple{}))>::value, 0ULL);
+};
+
+TTS_CASE("Check views pipelines copy nothing until to_tuple")
+{
+  auto a = kumi::tuple{counted{1}, counted{2}};
+  auto b = kumi::tuple{counted{3}, counted{4}};
+
+  counted::copies = 0;
+
+  auto pipeline = kumi::views::reorder<3,1,2,0>(kumi::views::cat(a, b));
+  auto sum      = kumi::apply([](auto const&... c) { return (c.value + ...); }, pipeline);
+  kumi::for_each([](auto& c) { c.value *= 10; }, pipeline);
+
+  auto zipped   = kumi::views::zip(pipeline, kumi::views::cat(b, a));
+  auto firsts   = kumi::views::transpose(zipped);
+
+  TTS_EQUAL(sum, 10);
+  TTS_EQUAL(get<0>(get<0>(firsts)), counted{40});
+  TTS_EQUAL(get<1>(get<0>(firsts)), counted{20});
+  TTS_EQUAL(get<3>(get<1>(firsts)), counted{20});
+  TTS_EQUAL(counted::copies, 0);
+
+  auto r = kumi::to_tuple(pipeline);
+  TTS_EQUAL(counted::copies, 4);
+  TTS_EQUAL(r, (kumi::tuple{counted{40}, counted{20}, counted{30}, counted{10}}));
+};
+
+TTS_CASE("Check views structured bindings and constexpr behavior")
+{
+  auto t        = kumi::tuple{1, 2.5};
+  auto [d, i]   = kumi::views::reorder<1,0>(t);
+  TTS_EQUAL(d, 2.5);
+  TTS_EQUAL(i, 1);
+
+  constexpr auto v = kumi::views::cat(kumi::tuple{1, 2}, kumi::tuple{3.5});
+  TTS_CONSTEXPR_EQUAL(get<2>(v), 3.5);
+  TTS_CONSTEXPR_EQUAL(kumi::to_tuple(v), (kumi::tuple{1, 2, 3.5}));
+  TTS_CONSTEXPR_EQUAL ( kumi::to_tuple(kumi::views::zip(kumi::tuple{1,2}, kumi::tuple{'a','b'}))
+                      , (kumi::tuple{kumi::tuple{1,'a'}, kumi::tuple{2,'b'}})
+                      );
+};
+
+TTS_CASE("Check views::cartesian_product behavior")
+{
+  auto a = kumi::tuple{1, 2.5, 'x'};
+  auto b = kumi::tuple{counted{3}, counted{4}};
+
+  counted::copies = 0;
+  auto v = kumi::views::cartesian_product(a, b);
+
+  TTS_EQUAL(kumi::size<decltype(v)>::value, 6ULL);
+  TTS_TYPE_IS(decltype(get<5>(v)), (kumi::tuple<char&, counted&>));
+  TTS_TYPE_IS((std::tuple_element_t<5, decltype(v)>), (kumi::tuple<char, counted>));
+
+  TTS_EQUAL(get<0>(v), (kumi::tuple{1   , counted{3}}));
+  TTS_EQUAL(get<1>(v), (kumi::tuple{2.5 , counted{3}}));
+  TTS_EQUAL(get<5>(v), (kumi::tuple{'x' , counted{4}}));
+  TTS_EQUAL(counted::copies, 0);
+
+  get<1>(get<3>(v)).value = 40;
+  TTS_EQUAL(get<1>(b), counted{40});
+
+  auto c = kumi::to_tuple(kumi::views::cartesian_product(kumi::tuple{1, 2}, kumi::tuple{'a', 'b'}));
+  TTS_EQUAL(c, kumi::cartesian_product(kumi::tuple{1, 2}, kumi::tuple{'a', 'b'}));
+  TTS_TYPE_IS ( decltype(c)
+              , decltype(kumi::cartesian_product(kumi::tuple{1, 2}, kumi::tuple{'a', 'b'}))
+              );
+
+  TTS_CONSTEXPR_EQUAL ( kumi::size<decltype(kumi::views::cartesian_product(kumi::tuple{1,2}
+                                                                          , kumi::tuple{}
+                                                                          )
+                                            )>::value
+                      , 0ULL
+                      );
+  TTS_CONSTEXPR_EQUAL ( get<3>(kumi::views::cartesian_product(kumi::tuple{1,2}, kumi::tuple{'a','b'}))
+                      , (kumi::tuple{2,'b'})
+                      );
+};
+
+TTS_CASE("Check for_each_combination behavior")
+{
+  auto a = kumi::tuple{counted{1}, counted{2}};
+  auto b = kumi::tuple{counted{10}, counted{20}, counted{30}};
+
+  counted::copies = 0;
+  int sum = 0, calls = 0;
+  kumi::for_each_combination([&](counted const& x, counted const& y) { sum += x.value * y.value; ++calls; }
+                            , a, b
+                            );
+
+  TTS_EQUAL(calls, 6);
+  TTS_EQUAL(sum, 180);
+  TTS_EQUAL(counted::copies, 0);
+};
+
+TTS_CASE("Check for_each_combination behavior with owned sources")
+{
+  using namespace std::literals;
+
+  std::string seen;
+  kumi::for_each_combination( [&](std::string s, int i) { seen += s + std::to_string(i) + ';'; }
+                            , kumi::tuple{"hello world, long enough to avoid SSO"s}
+                            , kumi::tuple{1, 2, 3}
+                            );
+
+  TTS_EQUAL ( seen
+            , "hello world, long enough to avoid SSO1;"
+              "hello world, long enough to avoid SSO2;"
+              "hello world, long enough to avoid SSO3;"s
+            );
+
+  std::string moved;
+  kumi::for_each_combination( [&](std::string s, int) { moved += s; }
+                            , kumi::tuple{"a"s, "b"s}
+                            , kumi::tuple{1}
+                            );
+  TTS_EQUAL(moved, "ab"s);
+
+  auto c = kumi::to_tuple ( kumi::views::cartesian_product( kumi::tuple{"hello world, long enough"s}
+                                                          , kumi::tuple{1, 2}
+                                                          )
+                          );
+  TTS_EQUAL ( c
+            , (kumi::tuple{ kumi::tuple{"hello world, long enough"s, 1}
+                          , kumi::tuple{"hello world, long enough"s, 2}
+                          }
+              )
+            );
+};
+
+TTS_CASE("Check views::cartesian_product rvalue access to owned sources")
+{
+  auto make = []
+  {
+    return kumi::views::cartesian_product(kumi::tuple{std::string(40,'x')}, kumi::tuple{1, 2});
+  };
+
+  auto v = make();
+  auto c0 = get<0>(std::move(v));
+  auto c1 = get<1>(std::move(v));
+  TTS_EQUAL(get<0>(c0), std::string(40,'x'));
+  TTS_EQUAL(get<0>(c1), std::string(40,'x'));
+
+  auto f = kumi::flatten_all(make());
+  TTS_EQUAL(get<0>(f), std::string(40,'x'));
+  TTS_EQUAL(get<2>(f), std::string(40,'x'));
+
+  auto m = kumi::map( [](auto&& c) { return std::string(get<0>(std::forward<decltype(c)>(c))); }
+                    , make()
+                    );
+  TTS_EQUAL(m, (kumi::tuple{std::string(40,'x'), std::string(40,'x')}));
+
+  // Only elements used in a single combination are moved out
+  auto w = kumi::views::cartesian_product ( kumi::tuple{std::string(40,'a'), std::string(40,'b')}
+                                          , kumi::tuple{1}
+                                          );
+  TTS_TYPE_IS(decltype(get<0>(get<1>(std::move(w)))), std::string&&);
+  TTS_TYPE_IS(decltype(get<1>(get<1>(std::move(w)))), int&);
+};
@@ -0,0 +1,83 @@
+//==================================================================================================
+/*
+  KUMI - Compact Tuple Tools
+  Copyright : KUMI Contributors & Maintainers
+  SPDX-License-Identifier: MIT
+*/
+//==================================================================================================
+#define TTS_MAIN
+#include <kumi/tuple.hpp>
+#include <tts/tts.hpp>
+#include <string>
+#include <type_traits>
+
+TTS_CASE("Check kumi::with_index behavior")
+{
+  auto square = [](auto i) { return i * i; };
+
+  TTS_EQUAL( kumi::with_index<5>(0, square), 0ULL  );
+  TTS_EQUAL( kumi::with_index<5>(3, square), 9ULL  );
+  TTS_EQUAL( kumi::with_index<5>(4, square), 16ULL );
+
+  TTS_CONSTEXPR_EQUAL( kumi::with_index<64>(42, [](auto i) { return i.value; }), 42ULL );
+};
+
+TTS_CASE("Check kumi::visit_at behavior")
+{
+  auto t = kumi::tuple{1, 2.5, 'z', 4ULL};
+
+  auto as_double = [](auto e) { return static_cast<double>(e); };
+  TTS_EQUAL( kumi::visit_at(t, 0, as_double), 1.   );
+  TTS_EQUAL( kumi::visit_at(t, 1, as_double), 2.5  );
+  TTS_EQUAL( kumi::visit_at(t, 2, as_double), 122. );
+  TTS_EQUAL( kumi::visit_at(t, 3, as_double), 4.   );
+
+  kumi::visit_at(t, 1, [](auto& e) { e *= 2; });
+  TTS_EQUAL( get<1>(t), 5. );
+
+  TTS_EQUAL( kumi::visit_at(t, kumi::locate(t, [](auto e) { return e > 4; }), as_double), 5. );
+};
+
+TTS_CASE("Check kumi::visit_at returns references and forwards rvalues")
+{
+  auto t = kumi::tuple{std::string{"a"}, std::string{"b"}};
+
+  std::string& ref = kumi::visit_at(t, 1, [](auto& s) -> std::string& { return s; });
+  TTS_EQUAL( &ref, &get<1>(t) );
+
+  auto moved = kumi::visit_at(std::move(t), 0, [](std::string&& s) { return std::move(s); });
+  TTS_EQUAL( moved, "a" );
+  TTS_EXPECT( get<0>(t).empty() );
+};
+
+TTS_CASE("Check kumi::visit_at constexpr behavior")
+{
+  constexpr auto t = kumi::tuple{1, 2.5, -3.6f, 4ULL};
+
+  TTS_CONSTEXPR_EQUAL( kumi::visit_at(t, 2, [](auto e) { return static_cast<int>(e); }), -3 );
+  TTS_CONSTEXPR_EQUAL( kumi::visit_at ( t
+                                      , kumi::locate(t, kumi::predicate<std::is_unsigned>())
+                                      , [](auto e) { return static_cast<int>(e); }
+                                      )
+                     , 4
+                     );
+};
+
+template<typename T, typename F>
+concept can_visit_at = requires(T&& t, F f) { kumi::visit_at(std::forward<T>(t), 0, f); };
+
+template<std::size_t N, typename F>
+concept can_with_index = requires(F f) { kumi::with_index<N>(0, f); };
+
+TTS_CASE("Check kumi::visit_at/with_index SFINAE behavior")
+{
+  auto id     = [](auto e) { return e; };
+  auto as_dbl = [](double e) { return e; };
+
+  TTS_EXPECT_NOT( (can_visit_at<kumi::tuple<int,double>, decltype(id)>)     );
+  TTS_EXPECT    ( (can_visit_at<kumi::tuple<int,double>, decltype(as_dbl)>) );
+  TTS_EXPECT_NOT( (can_visit_at<kumi::tuple<>, decltype(id)>)               );
+  TTS_EXPECT_NOT( (can_with_index<0, decltype(id)>)                         );
+  TTS_EXPECT_NOT( (can_with_index<2, decltype(id)>)                         );
+  TTS_EXPECT    ( (can_with_index<2, decltype(as_dbl)>)                     );
+};